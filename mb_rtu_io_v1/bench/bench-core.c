@@ -0,0 +1,345 @@
+/*
+ * File:   bench-core.c
+ * Author: thanho
+ *
+ * Microbenchmarks of the protocol core hot paths, reported in ns and cycles
+ * per operation. Cycles come from the TSC on x86. The file is not part of the
+ * MPLAB project, bench_core() is kept apart from main() and reads CP0 Count
+ * (half the CPU clock) under XC32 so a firmware build can call it once after
+ * SYS_Initialize() and print the table on UART2.
+ *
+ *   cmake --build build && ./build/bench-core [rounds]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "modbus-rtu.h"
+#include "modbus-crc.h"
+#include "modbus-hal.h"
+
+#if defined(__XC32)
+#include <xc.h>
+#define HAVE_CYCLES             1
+/* Count advances every other CPU cycle */
+#define cycles()                ((uint64_t)_CP0_GET_COUNT() * 2U)
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_CYCLES             1
+#define cycles()                __rdtsc()
+#else
+#define HAVE_CYCLES             0
+#define cycles()                0ULL
+#endif
+
+#define BENCH_ROUNDS            20000
+#define BENCH_SLAVE_ID          1
+#define BENCH_NB_BITS           100
+#define BENCH_NB_REGISTERS      10
+#define BENCH_HI(nb)            ((nb) >> 8)
+#define BENCH_LO(nb)            ((nb) & 0xFF)
+/* Frame whose CRC check is timed alone */
+#define BENCH_CHECK_FRAME       "mb_reply 10 10"
+
+typedef struct _bench_frame_t {
+    const char  *name;
+    uint8_t     adu[MODBUS_MAX_ADU_LENGTH];
+    uint16_t    length;
+} bench_frame_t;
+
+typedef struct _bench_t {
+    const char  *name;
+    void        (*run)(void *arg);
+    void        *arg;
+} bench_t;
+
+static volatile uint32_t sink;
+/* Function code and length of the last reply */
+static uint8_t sink_function;
+static size_t sink_length;
+static mb_mapping_t mapping;
+static mb_t mb;
+
+/* Replies go nowhere, only the core is measured */
+static void sink_begin(uint32_t baud)
+{
+}
+
+static size_t sink_available(void)
+{
+    return 0;
+}
+
+static uint8_t sink_read(void)
+{
+    return 0;
+}
+
+static void sink_write(uint8_t* buf, const size_t size)
+{
+    sink += size;
+    sink_function = buf[1];
+    sink_length = size;
+}
+
+static const serial_t serial_sink = {
+    .name           = "SINK",
+    .begin          = sink_begin,
+    .available      = sink_available,
+    .read           = sink_read,
+    .write          = sink_write,
+};
+
+/* Each function code at its smallest, a mid-size and its largest quantity */
+static bench_frame_t frames[] = {
+    { "mb_reply 01 1",     { BENCH_SLAVE_ID, MODBUS_FC_READ_COILS, 0, 3, 0, 1 } },
+    { "mb_reply 01 100",   { BENCH_SLAVE_ID, MODBUS_FC_READ_COILS, 0, 3, 0, BENCH_NB_BITS } },
+    { "mb_reply 01 2000",  { BENCH_SLAVE_ID, MODBUS_FC_READ_COILS, 0, 3,
+                             BENCH_HI(MODBUS_MAX_READ_BITS), BENCH_LO(MODBUS_MAX_READ_BITS) } },
+    { "mb_reply 02 1",     { BENCH_SLAVE_ID, MODBUS_FC_READ_DISCRETE_INPUTS, 0, 3, 0, 1 } },
+    { "mb_reply 02 100",   { BENCH_SLAVE_ID, MODBUS_FC_READ_DISCRETE_INPUTS, 0, 3, 0, BENCH_NB_BITS } },
+    { "mb_reply 02 2000",  { BENCH_SLAVE_ID, MODBUS_FC_READ_DISCRETE_INPUTS, 0, 3,
+                             BENCH_HI(MODBUS_MAX_READ_BITS), BENCH_LO(MODBUS_MAX_READ_BITS) } },
+    { "mb_reply 03 1",     { BENCH_SLAVE_ID, MODBUS_FC_READ_HOLDING_REGISTERS, 0, 0, 0, 1 } },
+    { "mb_reply 03 10",    { BENCH_SLAVE_ID, MODBUS_FC_READ_HOLDING_REGISTERS, 0, 0, 0, BENCH_NB_REGISTERS } },
+    { "mb_reply 03 125",   { BENCH_SLAVE_ID, MODBUS_FC_READ_HOLDING_REGISTERS, 0, 0, 0, MODBUS_MAX_READ_REGISTERS } },
+    { "mb_reply 04 1",     { BENCH_SLAVE_ID, MODBUS_FC_READ_INPUT_REGISTERS, 0, 0, 0, 1 } },
+    { "mb_reply 04 10",    { BENCH_SLAVE_ID, MODBUS_FC_READ_INPUT_REGISTERS, 0, 0, 0, BENCH_NB_REGISTERS } },
+    { "mb_reply 04 125",   { BENCH_SLAVE_ID, MODBUS_FC_READ_INPUT_REGISTERS, 0, 0, 0, MODBUS_MAX_READ_REGISTERS } },
+    { "mb_reply 05",       { BENCH_SLAVE_ID, MODBUS_FC_WRITE_SINGLE_COIL, 0, 7, 0xFF, 0x00 } },
+    { "mb_reply 06",       { BENCH_SLAVE_ID, MODBUS_FC_WRITE_SINGLE_REGISTER, 0, 7, 0x12, 0x34 } },
+    { "mb_reply 0F 1",     { BENCH_SLAVE_ID, MODBUS_FC_WRITE_MULTIPLE_COILS, 0, 3, 0, 1, 1 } },
+    { "mb_reply 0F 100",   { BENCH_SLAVE_ID, MODBUS_FC_WRITE_MULTIPLE_COILS, 0, 3, 0, BENCH_NB_BITS,
+                             (BENCH_NB_BITS + 7) / 8 } },
+    { "mb_reply 0F 1968",  { BENCH_SLAVE_ID, MODBUS_FC_WRITE_MULTIPLE_COILS, 0, 3,
+                             BENCH_HI(MODBUS_MAX_WRITE_BITS), BENCH_LO(MODBUS_MAX_WRITE_BITS),
+                             MODBUS_MAX_WRITE_BITS / 8 } },
+    { "mb_reply 10 1",     { BENCH_SLAVE_ID, MODBUS_FC_WRITE_MULTIPLE_REGISTERS, 0, 0, 0, 1, 2 } },
+    { "mb_reply 10 10",    { BENCH_SLAVE_ID, MODBUS_FC_WRITE_MULTIPLE_REGISTERS, 0, 0, 0, BENCH_NB_REGISTERS,
+                             2 * BENCH_NB_REGISTERS } },
+    { "mb_reply 10 123",   { BENCH_SLAVE_ID, MODBUS_FC_WRITE_MULTIPLE_REGISTERS, 0, 0, 0, MODBUS_MAX_WRITE_REGISTERS,
+                             2 * MODBUS_MAX_WRITE_REGISTERS } },
+    { "mb_reply 16",       { BENCH_SLAVE_ID, MODBUS_FC_MASK_WRITE_REGISTER, 0, 7, 0xF0, 0xF0, 0x0F, 0x01 } },
+    { "mb_reply 17 1/1",   { BENCH_SLAVE_ID, MODBUS_FC_WRITE_AND_READ_REGISTERS, 0, 0, 0, 1, 0, 0, 0, 1, 2 } },
+    { "mb_reply 17 10/10", { BENCH_SLAVE_ID, MODBUS_FC_WRITE_AND_READ_REGISTERS, 0, 0, 0, BENCH_NB_REGISTERS,
+                             0, 0, 0, BENCH_NB_REGISTERS, 2 * BENCH_NB_REGISTERS } },
+    { "mb_reply 17 125/121", { BENCH_SLAVE_ID, MODBUS_FC_WRITE_AND_READ_REGISTERS, 0, 0, 0, MODBUS_MAX_WR_READ_REGISTERS,
+                             0, 0, 0, MODBUS_MAX_WR_WRITE_REGISTERS, 2 * MODBUS_MAX_WR_WRITE_REGISTERS } },
+};
+
+#define BENCH_NB_FRAMES         (sizeof(frames) / sizeof(frames[0]))
+
+static bench_frame_t *frame_find(const char *name)
+{
+    size_t i;
+
+    for (i = 0; i < BENCH_NB_FRAMES; i++) {
+        if (strcmp(frames[i].name, name) == 0) {
+            return &frames[i];
+        }
+    }
+    return NULL;
+}
+
+/* Header bytes of a request, the values to write follow */
+static uint16_t frame_meta(uint8_t function)
+{
+    switch (function) {
+    case MODBUS_FC_WRITE_MULTIPLE_COILS:
+    case MODBUS_FC_WRITE_MULTIPLE_REGISTERS:
+        return 7;
+    case MODBUS_FC_MASK_WRITE_REGISTER:
+        return 8;
+    case MODBUS_FC_WRITE_AND_READ_REGISTERS:
+        return 11;
+    default:
+        return 6;
+    }
+}
+
+/* Length of the normal reply, CRC included */
+static size_t frame_reply_length(const uint8_t *adu)
+{
+    uint16_t nb = (adu[4] << 8) + adu[5];
+
+    switch (adu[1]) {
+    case MODBUS_FC_READ_COILS:
+    case MODBUS_FC_READ_DISCRETE_INPUTS:
+        return 5 + (nb + 7) / 8;
+    case MODBUS_FC_READ_HOLDING_REGISTERS:
+    case MODBUS_FC_READ_INPUT_REGISTERS:
+    case MODBUS_FC_WRITE_AND_READ_REGISTERS:
+        return 5 + 2 * nb;
+    case MODBUS_FC_MASK_WRITE_REGISTER:
+        return 10;
+    default:
+        return 8;
+    }
+}
+
+static uint8_t crc_buf[MODBUS_MAX_ADU_LENGTH];
+static uint8_t bytes[MODBUS_MAX_READ_BITS / 8 + 1];
+static uint16_t float_regs[2];
+
+static void frames_init(void)
+{
+    size_t i;
+
+    for (i = 0; i < BENCH_NB_FRAMES; i++) {
+        bench_frame_t *frame = &frames[i];
+        uint16_t length = frame_meta(frame->adu[1]);
+        uint16_t crc;
+
+        if (frame->adu[1] == MODBUS_FC_WRITE_MULTIPLE_COILS
+                || frame->adu[1] == MODBUS_FC_WRITE_MULTIPLE_REGISTERS
+                || frame->adu[1] == MODBUS_FC_WRITE_AND_READ_REGISTERS) {
+            uint8_t nb_bytes = frame->adu[length - 1];
+
+            memset(frame->adu + length, 0xA5, nb_bytes);
+            length += nb_bytes;
+        }
+        crc = crc16(frame->adu, length);
+        frame->adu[length++] = crc >> 8;
+        frame->adu[length++] = crc & 0xFF;
+        frame->length = length;
+    }
+}
+
+/* Frame check, CRC and addressing, then mb_reply and send_msg */
+static void run_frame(void *arg)
+{
+    bench_frame_t *frame = arg;
+
+    mb_rx_frame(&mb, frame->adu, frame->length);
+    mb_loop(&mb);
+}
+
+static void run_crc16(void *arg)
+{
+    sink += crc16(crc_buf, MODBUS_RTU_MAX_ADU_LENGTH);
+}
+
+static void run_frame_check(void *arg)
+{
+    bench_frame_t *frame = arg;
+
+    sink += crc16(frame->adu, frame->length) == 0;
+}
+
+static void run_get_bytes(void *arg)
+{
+    sink += modbus_bitmap_get_bytes(mapping.tab_bits, 3, MODBUS_MAX_READ_BITS, bytes);
+}
+
+static void run_set_bytes(void *arg)
+{
+    modbus_bitmap_set_bytes(mapping.tab_bits, 3, MODBUS_MAX_WRITE_BITS, bytes);
+}
+
+static void run_get_float(void *arg)
+{
+    float (*get)(const uint16_t *src) = arg;
+
+    sink += (uint32_t)get(float_regs);
+}
+
+static void run_set_float(void *arg)
+{
+    void (*set)(float f, uint16_t *dest) = arg;
+
+    set(1234.5f + sink, float_regs);
+    sink += float_regs[1];
+}
+
+static void bench_run(const bench_t *bench, int rounds)
+{
+    uint32_t t0, t1;
+    uint64_t c0, c1;
+    double ns;
+    int i;
+
+    /* Warm the caches and branch predictors */
+    bench->run(bench->arg);
+
+    t0 = mb_hal_ticks();
+    c0 = cycles();
+    for (i = 0; i < rounds; i++) {
+        bench->run(bench->arg);
+    }
+    c1 = cycles();
+    t1 = mb_hal_ticks();
+
+    ns = (double)(uint32_t)(t1 - t0) * (1e9 / MODBUS_HAL_TICKS_FREQUENCY) / rounds;
+    if (HAVE_CYCLES) {
+        printf("%-24s %12.1f %12.1f\n", bench->name, ns, (double)(c1 - c0) / rounds);
+    }
+    else {
+        printf("%-24s %12.1f %12s\n", bench->name, ns, "n/a");
+    }
+}
+
+int bench_core(int rounds)
+{
+    bench_frame_t *check_frame = frame_find(BENCH_CHECK_FRAME);
+    const bench_t benches[] = {
+        { "crc16 256 bytes",         run_crc16,       NULL },
+        { "check " BENCH_CHECK_FRAME, run_frame_check, check_frame },
+        { "response_io_status 2000", run_get_bytes,   NULL },
+        { "set_bits 1968",           run_set_bytes,   NULL },
+        { "modbus_get_float_abcd",   run_get_float,   modbus_get_float_abcd },
+        { "modbus_get_float_dcba",   run_get_float,   modbus_get_float_dcba },
+        { "modbus_get_float_badc",   run_get_float,   modbus_get_float_badc },
+        { "modbus_get_float_cdab",   run_get_float,   modbus_get_float_cdab },
+        { "modbus_set_float_abcd",   run_set_float,   modbus_set_float_abcd },
+        { "modbus_set_float_dcba",   run_set_float,   modbus_set_float_dcba },
+        { "modbus_set_float_badc",   run_set_float,   modbus_set_float_badc },
+        { "modbus_set_float_cdab",   run_set_float,   modbus_set_float_cdab },
+    };
+    int failures = 0;
+    size_t i;
+
+    if (check_frame == NULL) {
+        printf("no frame %s\n", BENCH_CHECK_FRAME);
+        return EXIT_FAILURE;
+    }
+
+    mb_mapping_init(&mapping);
+    mb_init(&mb, &mapping, &serial_sink, 115200);
+    mb_set_slave(&mb, BENCH_SLAVE_ID);
+    frames_init();
+    for (i = 0; i < sizeof(crc_buf); i++) {
+        crc_buf[i] = i * 7;
+    }
+    for (i = 0; i < sizeof(bytes); i++) {
+        bytes[i] = i * 13;
+    }
+
+    /* Every request must get its normal reply, an exception would time the
+       error path instead */
+    for (i = 0; i < BENCH_NB_FRAMES; i++) {
+        sink_length = 0;
+        run_frame(&frames[i]);
+        if (sink_function != frames[i].adu[1] || sink_length != frame_reply_length(frames[i].adu)) {
+            printf("%s: reply %02X, %u bytes\n", frames[i].name, sink_function, (unsigned)sink_length);
+            failures++;
+        }
+    }
+
+    printf("%-24s %12s %12s\n", "operation", "ns/op", "cycles/op");
+    for (i = 0; i < sizeof(benches) / sizeof(benches[0]); i++) {
+        bench_run(&benches[i], rounds);
+    }
+    for (i = 0; i < BENCH_NB_FRAMES; i++) {
+        bench_t bench = { frames[i].name, run_frame, &frames[i] };
+
+        bench_run(&bench, rounds);
+    }
+    return failures != 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+#ifndef __XC32
+int main(int argc, char *argv[])
+{
+    return bench_core(argc > 1 ? atoi(argv[1]) : BENCH_ROUNDS);
+}
+#endif
@@ -0,0 +1,93 @@
+/*
+ * File:   bench-crc.c
+ * Author: thanho
+ *
+ * Host microbenchmark of the CRC-16 engines, reports cycles and ns per byte.
+ *
+ *   cc -O2 -DMODBUS_CRC_ALL_ENGINES -I../mb_rtu_io_v1.X \
+ *      bench-crc.c ../mb_rtu_io_v1.X/modbus-crc.c -o bench-crc
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include "modbus-crc.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_CYCLES        1
+#define cycles()           __rdtsc()
+#else
+#define HAVE_CYCLES        0
+#define cycles()           0ULL
+#endif
+
+#define BENCH_FRAME_LENGTH      256
+#define BENCH_ROUNDS            20000
+
+typedef struct _engine_t {
+    const char* name;
+    uint16_t    (*crc)(const uint8_t *buf, uint16_t length);
+} engine_t;
+
+static const engine_t engines[] = {
+    { "bitwise", crc16_bitwise },
+    { "nibble",  crc16_nibble },
+    { "table",   crc16_table },
+};
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+int main(void)
+{
+    uint8_t frame[BENCH_FRAME_LENGTH];
+    /* Known answer: 01 03 00 00 00 0A -> CRC C5 CD */
+    const uint8_t check[] = { 0x01, 0x03, 0x00, 0x00, 0x00, 0x0A };
+    volatile uint16_t sink = 0;
+    size_t e;
+    int i;
+
+    srand(1);
+    for (i = 0; i < BENCH_FRAME_LENGTH; i++) {
+        frame[i] = rand() & 0xFF;
+    }
+
+    printf("%-8s %12s %12s\n", "engine", "cycles/byte", "ns/byte");
+    for (e = 0; e < sizeof(engines) / sizeof(engines[0]); e++) {
+        const engine_t *engine = &engines[e];
+        uint64_t t0, t1, c0, c1;
+        double bytes = (double)BENCH_FRAME_LENGTH * BENCH_ROUNDS;
+
+        if (engine->crc(check, sizeof(check)) != 0xC5CD
+                || engine->crc(frame, BENCH_FRAME_LENGTH) != crc16_bitwise(frame, BENCH_FRAME_LENGTH)) {
+            printf("%-8s wrong CRC\n", engine->name);
+            return EXIT_FAILURE;
+        }
+
+        t0 = now_ns();
+        c0 = cycles();
+        for (i = 0; i < BENCH_ROUNDS; i++) {
+            frame[0] = i;
+            sink ^= engine->crc(frame, BENCH_FRAME_LENGTH);
+        }
+        c1 = cycles();
+        t1 = now_ns();
+
+        if (HAVE_CYCLES) {
+            printf("%-8s %12.2f %12.3f\n", engine->name, (c1 - c0) / bytes, (t1 - t0) / bytes);
+        }
+        else {
+            printf("%-8s %12s %12.3f\n", engine->name, "n/a", (t1 - t0) / bytes);
+        }
+    }
+    (void)sink;
+
+    return EXIT_SUCCESS;
+}
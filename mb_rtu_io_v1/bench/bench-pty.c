@@ -0,0 +1,163 @@
+/*
+ * File:   bench-pty.c
+ * Author: thanho
+ *
+ * End to end slave benchmark over a pseudo-terminal: a child process runs the
+ * slave core on serial_posix, the parent plays the master and reports
+ * requests per second and request to response turnaround. The run stops
+ * and fails on the first request without a valid response.
+ *
+ *   ./bench-pty [requests] [baud]
+ *
+ * A pty has no line speed, only the T3.5 silence the slave enforces between
+ * frames (fixed to 1750 us above 19200 baud) paces the exchange.
+ */
+
+#include <poll.h>
+#include <pty.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+#include "modbus-crc.h"
+#include "modbus-hal.h"
+#include "serial-posix.h"
+
+#define BENCH_SLAVE_ID          1
+#define BENCH_NB_REGISTERS      10
+/* Margin over T3.5 so scheduling jitter never glues two frames */
+#define BENCH_GAP_MARGIN_US     250
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void run_slave(int fd, uint32_t baud)
+{
+    static mb_mapping_t mapping;
+    static mb_t mb;
+
+    serial_posix_attach(fd);
+    mb_mapping_init(&mapping);
+    mb_init(&mb, &mapping, &serial_posix, baud);
+    if (!serial_posix_is_open()) {
+        fprintf(stderr, "%u baud not supported\n", baud);
+        _exit(EXIT_FAILURE);
+    }
+    mb_set_slave(&mb, BENCH_SLAVE_ID);
+    for (;;) {
+        if (serial_posix_wait(-1) < 0) {
+            break;
+        }
+        mb_loop(&mb);
+    }
+    _exit(EXIT_SUCCESS);
+}
+
+/* Reads exactly length bytes or fails after timeout_ms without any */
+static int read_frame(int fd, uint8_t *buf, int length, int timeout_ms)
+{
+    int done = 0;
+
+    while (done < length) {
+        struct pollfd pfd = { .fd = fd, .events = POLLIN };
+        ssize_t n;
+
+        if (poll(&pfd, 1, timeout_ms) <= 0) {
+            return -1;
+        }
+        n = read(fd, buf + done, length - done);
+        if (n <= 0) {
+            return -1;
+        }
+        done += n;
+    }
+    return done;
+}
+
+int main(int argc, char *argv[])
+{
+    int requests = argc > 1 ? atoi(argv[1]) : 2000;
+    uint32_t baud = argc > 2 ? (uint32_t)atoi(argv[2]) : 115200;
+    uint8_t req[8] = { BENCH_SLAVE_ID, MODBUS_FC_READ_HOLDING_REGISTERS, 0, 0, 0, BENCH_NB_REGISTERS };
+    uint8_t rsp[MODBUS_MAX_ADU_LENGTH];
+    const int rsp_length = 3 + 2 * BENCH_NB_REGISTERS + MODBUS_RTU_CHECKSUM_LENGTH;
+    uint64_t gap_ns, t_start, t_last, sum = 0, min = UINT64_MAX, max = 0;
+    uint16_t crc;
+    int master, slave, i;
+    struct termios tio;
+    pid_t pid;
+
+    if (openpty(&master, &slave, NULL, NULL, NULL) != 0) {
+        perror("openpty");
+        return EXIT_FAILURE;
+    }
+    /* The master side stays raw too, no echo or CR/LF translation */
+    tcgetattr(master, &tio);
+    cfmakeraw(&tio);
+    tcsetattr(master, TCSANOW, &tio);
+
+    pid = fork();
+    if (pid == 0) {
+        close(master);
+        run_slave(slave, baud);
+    }
+    close(slave);
+
+    crc = crc16(req, 6);
+    req[6] = crc >> 8;
+    req[7] = crc & 0xFF;
+    gap_ns = baud > MODBUS_RTU_FIXED_TIMING_BAUD
+            ? MODBUS_RTU_T35_FIXED_US * 1000ULL
+            : 77ULL * 1000000000ULL / (2ULL * baud);
+    /* A pty delivers the first byte at once, on a line it would complete one
+       11-bit character after the silence and the slave counts that in */
+    gap_ns += 11ULL * 1000000000ULL / baud + BENCH_GAP_MARGIN_US * 1000ULL;
+
+    t_start = t_last = now_ns();
+    for (i = 0; i < requests; i++) {
+        uint64_t t0, t1;
+
+        /* Honour T3.5 since the end of the previous response */
+        while (now_ns() - t_last < gap_ns) {
+        }
+        t0 = now_ns();
+        if (write(master, req, sizeof(req)) != sizeof(req)
+                || read_frame(master, rsp, rsp_length, 100) != rsp_length
+                || crc16(rsp, rsp_length) != 0) {
+            /* The run stops on the first failed exchange, a slave that could
+               not start has already said why */
+            if (waitpid(pid, NULL, WNOHANG) == pid) {
+                return EXIT_FAILURE;
+            }
+            break;
+        }
+        t1 = t_last = now_ns();
+        sum += t1 - t0;
+        min = t1 - t0 < min ? t1 - t0 : min;
+        max = t1 - t0 > max ? t1 - t0 : max;
+    }
+    t_last = now_ns();
+
+    kill(pid, SIGTERM);
+    waitpid(pid, NULL, 0);
+
+    printf("%d requests at %u baud", i, baud);
+    if (i < requests) {
+        printf(", request %d failed", i + 1);
+    }
+    printf("\n");
+    printf("requests/s       %10.1f\n", i * 1e9 / (double)(t_last - t_start));
+    if (i > 0) {
+        printf("turnaround (us)  min %.1f avg %.1f max %.1f\n",
+               min / 1e3, sum / 1e3 / i, max / 1e3);
+    }
+
+    return i < requests ? EXIT_FAILURE : EXIT_SUCCESS;
+}
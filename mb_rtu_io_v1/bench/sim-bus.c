@@ -0,0 +1,280 @@
+/*
+ * File:   sim-bus.c
+ * Author: thanho
+ *
+ * Deterministic RS-485 bus simulator in virtual time. A scripted master polls
+ * N slaves round robin with FC 0x03, every character takes exactly 11 bit
+ * times on the line and the master keeps T3.5 between frames. Each slave is
+ * its own mb_t context, all sharing one register map, and runs unmodified on
+ * a virtual clock (mb_hal_host_set_clock). The serial_t hands every byte on
+ * the bus, requests and the other slaves' responses, to every context at its
+ * arrival time like an RX interrupt would.
+ *
+ *   ./sim-bus [slaves] [baud] [poll_us] [proc_us] [cycles] [registers]
+ *
+ * poll_us is the period of the slaves main loop, 0 calls mb_loop() at every
+ * received character. proc_us is the time the slave takes from frame
+ * complete to the first response character. Two slaves answering the same
+ * request count as a collision.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "modbus-rtu.h"
+#include "modbus-crc.h"
+#include "modbus-hal-host.h"
+
+#define SIM_MAX_SLAVES          247
+#define SIM_TICKS_PER_US        (MODBUS_HAL_TICKS_FREQUENCY / 1000000U)
+
+typedef struct _sim_slave_t {
+    uint32_t    requests;
+    uint32_t    timeouts;
+    uint64_t    turnaround_sum;
+    uint64_t    turnaround_min;
+    uint64_t    turnaround_max;
+} sim_slave_t;
+
+/* Virtual time in HAL ticks */
+static uint64_t sim_now;
+
+/* Request on the wire, byte i is complete at rx_start + (i + 1) * char time */
+static uint8_t rx_frame[MODBUS_MAX_ADU_LENGTH];
+static size_t rx_length;
+static size_t rx_pos;
+static uint64_t rx_start;
+static uint64_t char_ticks;
+
+/* Response written by the slave and when */
+static uint8_t tx_frame[MODBUS_MAX_ADU_LENGTH];
+static size_t tx_length;
+static uint64_t tx_ticks;
+static uint32_t collisions;
+
+/* Every context on the bus and who is writing */
+static mb_t contexts[SIM_MAX_SLAVES + 1];
+static void (*rx_handlers[SIM_MAX_SLAVES + 1])(mb_t *mb, uint8_t c);
+static mb_t *rx_contexts[SIM_MAX_SLAVES + 1];
+static int nb_listeners;
+static mb_t *sim_current;
+
+static uint32_t sim_ticks(void)
+{
+    return (uint32_t)sim_now;
+}
+
+static void sim_begin(uint32_t baud)
+{
+}
+
+/* Bytes are pushed by the simulator, never polled */
+static size_t sim_available(void)
+{
+    return 0;
+}
+
+static uint8_t sim_read(void)
+{
+    return 0;
+}
+
+static void sim_write(uint8_t* buf, const size_t size)
+{
+    if (tx_length != 0) {
+        collisions++;
+        return;
+    }
+    memcpy(tx_frame, buf, size);
+    tx_length = size;
+    tx_ticks = sim_now;
+}
+
+/* Each context registers once, they all hear the same line */
+static void sim_set_rx_handler(void (*handler)(mb_t *mb, uint8_t c), mb_t *mb)
+{
+    rx_handlers[nb_listeners] = handler;
+    rx_contexts[nb_listeners] = mb;
+    nb_listeners++;
+}
+
+static const serial_t serial_sim = {
+    .name           = "SIM",
+    .begin          = sim_begin,
+    .available      = sim_available,
+    .read           = sim_read,
+    .write          = sim_write,
+    .set_rx_handler = sim_set_rx_handler,
+};
+
+/* Byte on the bus, heard by everybody but its sender */
+static void sim_deliver(uint8_t c, const mb_t *sender)
+{
+    int i;
+
+    for (i = 0; i < nb_listeners; i++) {
+        if (rx_contexts[i] != sender) {
+            rx_handlers[i](rx_contexts[i], c);
+        }
+    }
+}
+
+/* One pass of every slave main loop, remembers who answered */
+static void sim_loop(int nb_slaves)
+{
+    int id;
+
+    for (id = 1; id <= nb_slaves; id++) {
+        size_t before = tx_length;
+
+        mb_loop(&contexts[id]);
+        if (before == 0 && tx_length != 0) {
+            sim_current = &contexts[id];
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    int nb_slaves = argc > 1 ? atoi(argv[1]) : 32;
+    uint32_t baud = argc > 2 ? (uint32_t)atoi(argv[2]) : 19200;
+    uint64_t poll_ticks = (argc > 3 ? atoi(argv[3]) : 0) * (uint64_t)SIM_TICKS_PER_US;
+    uint64_t proc_ticks = (argc > 4 ? atoi(argv[4]) : 50) * (uint64_t)SIM_TICKS_PER_US;
+    int cycles = argc > 5 ? atoi(argv[5]) : 100;
+    int nb_registers = argc > 6 ? atoi(argv[6]) : 10;
+    static sim_slave_t slaves[SIM_MAX_SLAVES + 1];
+    static mb_mapping_t mapping;
+    uint64_t t35_ticks, timeout_ticks, bus_busy = 0, bus_free, t_end;
+    uint32_t done = 0, timeouts = 0;
+    int cycle, id;
+
+    if (nb_slaves < 1 || nb_slaves > SIM_MAX_SLAVES || baud == 0 || cycles < 1
+            || nb_registers < 1 || nb_registers > MODBUS_MAX_READ_REGISTERS) {
+        fprintf(stderr, "usage: %s [slaves] [baud] [poll_us] [proc_us] [cycles] [registers]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    char_ticks = (uint64_t)MODBUS_HAL_TICKS_FREQUENCY * 11U / baud;
+    t35_ticks = baud > MODBUS_RTU_FIXED_TIMING_BAUD
+            ? (uint64_t)MODBUS_RTU_T35_FIXED_US * SIM_TICKS_PER_US
+            : (uint64_t)MODBUS_HAL_TICKS_FREQUENCY * 77U / (2U * baud);
+    timeout_ticks = 100000ULL * SIM_TICKS_PER_US;
+
+    mb_hal_host_set_clock(sim_ticks);
+    /* Start far enough from 0 that the first frame follows a T3.5 silence */
+    sim_now = t35_ticks;
+    mb_mapping_init(&mapping);
+    for (id = 1; id <= nb_slaves; id++) {
+        mb_init(&contexts[id], &mapping, &serial_sim, baud);
+        mb_set_slave(&contexts[id], id);
+    }
+    bus_free = sim_now + t35_ticks;
+    rx_start = bus_free;
+
+    for (cycle = 0; cycle < cycles; cycle++) {
+        for (id = 1; id <= nb_slaves; id++) {
+            sim_slave_t *slave = &slaves[id];
+            uint64_t rx_end, t, turnaround;
+            uint16_t crc;
+            size_t i;
+
+            rx_frame[0] = id;
+            rx_frame[1] = MODBUS_FC_READ_HOLDING_REGISTERS;
+            rx_frame[2] = 0;
+            rx_frame[3] = 0;
+            rx_frame[4] = nb_registers >> 8;
+            rx_frame[5] = nb_registers & 0xFF;
+            crc = crc16(rx_frame, 6);
+            rx_frame[6] = crc >> 8;
+            rx_frame[7] = crc & 0xFF;
+            rx_length = 8;
+            rx_pos = 0;
+            rx_start = bus_free + t35_ticks;
+            rx_end = rx_start + rx_length * char_ticks;
+            bus_busy += rx_length * char_ticks;
+            tx_length = 0;
+            sim_current = NULL;
+            slave->requests++;
+
+            /* Run the slave loops until one answers or the master gives up */
+            t = poll_ticks == 0 ? rx_start + char_ticks
+                    : (rx_start + poll_ticks) / poll_ticks * poll_ticks;
+            while (tx_length == 0 && t <= rx_end + timeout_ticks) {
+                /* Characters complete by t reach every receiver */
+                while (rx_pos < rx_length && rx_start + (rx_pos + 1) * char_ticks <= t) {
+                    sim_now = rx_start + (rx_pos + 1) * char_ticks;
+                    sim_deliver(rx_frame[rx_pos++], NULL);
+                }
+                sim_now = t;
+                sim_loop(nb_slaves);
+                if (poll_ticks == 0) {
+                    if (rx_pos == rx_length) {
+                        /* Nothing more arrives, the event driven slaves sleep */
+                        break;
+                    }
+                    t += char_ticks;
+                }
+                else {
+                    t += poll_ticks;
+                }
+            }
+            if (tx_length == 0) {
+                /* The whole request is on the line anyway */
+                while (rx_pos < rx_length) {
+                    sim_now = rx_start + (rx_pos + 1) * char_ticks;
+                    sim_deliver(rx_frame[rx_pos++], NULL);
+                }
+            }
+
+            if (tx_length == 0) {
+                slave->timeouts++;
+                timeouts++;
+                bus_free = rx_end + timeout_ticks;
+                continue;
+            }
+
+            /* Turnaround: last request character to first response one */
+            turnaround = tx_ticks + proc_ticks - rx_end;
+            bus_busy += tx_length * char_ticks;
+            bus_free = tx_ticks + proc_ticks + tx_length * char_ticks;
+            /* The other slaves hear the response */
+            for (i = 0; i < tx_length; i++) {
+                sim_now = tx_ticks + proc_ticks + (i + 1) * char_ticks;
+                sim_deliver(tx_frame[i], sim_current);
+            }
+            sim_now = bus_free;
+            sim_loop(nb_slaves);
+            slave->turnaround_sum += turnaround;
+            if (slave->turnaround_min == 0 || turnaround < slave->turnaround_min) {
+                slave->turnaround_min = turnaround;
+            }
+            if (turnaround > slave->turnaround_max) {
+                slave->turnaround_max = turnaround;
+            }
+            done++;
+        }
+    }
+    t_end = bus_free;
+
+    printf("%d slaves, %u baud, poll %llu us, processing %llu us, %d registers\n",
+           nb_slaves, baud, (unsigned long long)(poll_ticks / SIM_TICKS_PER_US),
+           (unsigned long long)(proc_ticks / SIM_TICKS_PER_US), nb_registers);
+    printf("%5s %8s %8s %12s %12s %12s\n", "slave", "requests", "timeouts", "min us", "avg us", "max us");
+    for (id = 1; id <= nb_slaves; id++) {
+        sim_slave_t *slave = &slaves[id];
+        uint32_t answered = slave->requests - slave->timeouts;
+
+        printf("%5d %8u %8u %12.1f %12.1f %12.1f\n", id, slave->requests, slave->timeouts,
+               (double)slave->turnaround_min / SIM_TICKS_PER_US,
+               answered ? (double)slave->turnaround_sum / answered / SIM_TICKS_PER_US : 0.0,
+               (double)slave->turnaround_max / SIM_TICKS_PER_US);
+    }
+    printf("virtual time     %12.3f ms\n", (double)(t_end - t35_ticks) / SIM_TICKS_PER_US / 1000.0);
+    printf("bus utilisation  %12.1f %%\n", 100.0 * bus_busy / (double)(t_end - t35_ticks));
+    printf("requests/s       %12.1f\n", done * (double)MODBUS_HAL_TICKS_FREQUENCY / (double)(t_end - t35_ticks));
+    printf("poll cycle       %12.3f ms for %d slaves\n",
+           (double)(t_end - t35_ticks) / cycles / SIM_TICKS_PER_US / 1000.0, nb_slaves);
+    printf("collisions       %12u\n", collisions);
+
+    return timeouts || collisions ? EXIT_FAILURE : EXIT_SUCCESS;
+}
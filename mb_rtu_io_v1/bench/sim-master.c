@@ -0,0 +1,337 @@
+/*
+ * File:   sim-master.c
+ * Author: thanho
+ *
+ * RS-485 segment in virtual time with the master engine on one end and N
+ * slave contexts on the other. Every character takes exactly 11 bit times on
+ * the line, whoever writes while the line is busy collides. The master polls
+ * a table of FC 0x03 and FC 0x01 reads, [entries] per slave of [registers]
+ * registers or coils each, all with period 0 so the bus runs flat out. As
+ * many FC 0x02 reads of discrete inputs per slave come every SIM_PERIOD_MS
+ * and one read of a slave nobody answers every SIM_ABSENT_PERIOD_MS, it must
+ * time out every time. The results are checked against the slaves' tables
+ * and the periodic entries against their period.
+ *
+ *   ./sim-master [slaves] [baud] [entries] [registers] [cycles] [proc_us] [gap] [hole]
+ *
+ * proc_us is the time a slave takes from frame complete to the first
+ * response character. A gap of 0 or more coalesces the entries of a slave
+ * with mb_master_plan(), hole leaves unpolled registers or bits between two
+ * entries. Unless registers + hole is a multiple of 8, the coalesced bit
+ * reads hand most entries a range that does not start on a byte.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "modbus-rtu.h"
+#include "modbus-master.h"
+#include "modbus-hal-host.h"
+
+#define SIM_MAX_SLAVES          32
+#define SIM_MAX_ENTRIES         16
+#define SIM_MAX_BYTES           4096
+#define SIM_TICKS_PER_US        (MODBUS_HAL_TICKS_FREQUENCY / 1000000U)
+#define SIM_MASTER              (-1)
+#define SIM_PERIOD_MS           100
+#define SIM_ABSENT_PERIOD_MS    500
+#define SIM_ABSENT_TIMEOUT_MS   20
+
+typedef struct _sim_byte_t {
+    uint64_t    ticks;
+    int         sender;
+    uint8_t     c;
+} sim_byte_t;
+
+/* Virtual time in HAL ticks */
+static uint64_t sim_now;
+static uint64_t char_ticks;
+static uint64_t proc_ticks;
+
+/* Characters on the line, each one complete at its ticks */
+static sim_byte_t line[SIM_MAX_BYTES];
+static size_t line_head;
+static size_t line_tail;
+static uint64_t line_free;
+static uint64_t line_busy;
+static uint32_t collisions;
+
+/* Who hears the line */
+static void (*master_handler)(mb_t *mb, uint8_t c);
+static mb_t *master_mb;
+static void (*slave_handlers[SIM_MAX_SLAVES])(mb_t *mb, uint8_t c);
+static mb_t *slave_mbs[SIM_MAX_SLAVES];
+static int nb_slave_listeners;
+/* Slave whose mb_loop() is running */
+static int sim_current;
+
+static uint32_t sim_ticks(void)
+{
+    return (uint32_t)sim_now;
+}
+
+static void sim_begin(uint32_t baud)
+{
+}
+
+/* Bytes are pushed by the simulator, never polled */
+static size_t sim_available(void)
+{
+    return 0;
+}
+
+static uint8_t sim_read(void)
+{
+    return 0;
+}
+
+static void sim_send(int sender, const uint8_t *buf, size_t size, uint64_t start)
+{
+    size_t i;
+
+    if (line_free > start) {
+        collisions++;
+        return;
+    }
+    for (i = 0; i < size && line_tail < SIM_MAX_BYTES; i++) {
+        line[line_tail].ticks = start + (i + 1) * char_ticks;
+        line[line_tail].sender = sender;
+        line[line_tail].c = buf[i];
+        line_tail++;
+    }
+    line_free = start + size * char_ticks;
+    line_busy += size * char_ticks;
+}
+
+static void sim_master_write(uint8_t *buf, const size_t size)
+{
+    sim_send(SIM_MASTER, buf, size, sim_now);
+}
+
+static void sim_slave_write(uint8_t *buf, const size_t size)
+{
+    sim_send(sim_current, buf, size, sim_now + proc_ticks);
+}
+
+static void sim_master_set_rx_handler(void (*handler)(mb_t *mb, uint8_t c), mb_t *mb)
+{
+    master_handler = handler;
+    master_mb = mb;
+}
+
+static void sim_slave_set_rx_handler(void (*handler)(mb_t *mb, uint8_t c), mb_t *mb)
+{
+    slave_handlers[nb_slave_listeners] = handler;
+    slave_mbs[nb_slave_listeners] = mb;
+    nb_slave_listeners++;
+}
+
+static const serial_t serial_master = {
+    .name           = "SIM-MASTER",
+    .begin          = sim_begin,
+    .available      = sim_available,
+    .read           = sim_read,
+    .write          = sim_master_write,
+    .set_rx_handler = sim_master_set_rx_handler,
+};
+
+static const serial_t serial_slave = {
+    .name           = "SIM-SLAVE",
+    .begin          = sim_begin,
+    .available      = sim_available,
+    .read           = sim_read,
+    .write          = sim_slave_write,
+    .set_rx_handler = sim_slave_set_rx_handler,
+};
+
+/* Hand the characters complete by t to everybody but their sender */
+static void sim_deliver(uint64_t t)
+{
+    int i;
+
+    while (line_head < line_tail && line[line_head].ticks <= t) {
+        const sim_byte_t *b = &line[line_head++];
+
+        sim_now = b->ticks;
+        if (b->sender != SIM_MASTER) {
+            master_handler(master_mb, b->c);
+        }
+        for (i = 0; i < nb_slave_listeners; i++) {
+            if (i != b->sender) {
+                slave_handlers[i](slave_mbs[i], b->c);
+            }
+        }
+    }
+    if (line_head == line_tail) {
+        line_head = line_tail = 0;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    int nb_slaves = argc > 1 ? atoi(argv[1]) : 8;
+    uint32_t baud = argc > 2 ? (uint32_t)atoi(argv[2]) : 19200;
+    int nb_entries = argc > 3 ? atoi(argv[3]) : 4;
+    int nb_registers = argc > 4 ? atoi(argv[4]) : 10;
+    int cycles = argc > 5 ? atoi(argv[5]) : 20;
+    proc_ticks = (argc > 6 ? atoi(argv[6]) : 50) * (uint64_t)SIM_TICKS_PER_US;
+    int gap = argc > 7 ? atoi(argv[7]) : -1;
+    int hole = argc > 8 ? atoi(argv[8]) : 0;
+    static mb_mapping_t mapping;
+    static mb_t slaves[SIM_MAX_SLAVES];
+    static mb_master_t master;
+    static mb_poll_t polls[SIM_MAX_SLAVES * SIM_MAX_ENTRIES * 3 + 1];
+    static uint16_t results[SIM_MAX_SLAVES][SIM_MAX_ENTRIES * MODBUS_MAX_READ_REGISTERS];
+    static uint32_t coils[SIM_MAX_SLAVES][MODBUS_BITMAP_WORDS(SIM_MAX_ENTRIES * MODBUS_MAX_READ_REGISTERS)];
+    static uint32_t inputs[SIM_MAX_SLAVES][MODBUS_BITMAP_WORDS(SIM_MAX_ENTRIES * MODBUS_MAX_READ_REGISTERS)];
+    static uint16_t absent[1];
+    mb_poll_t *absent_poll;
+    uint64_t step, t_start, t_end, elapsed_ms;
+    uint32_t exchanges = 0, failures = 0, mismatches = 0, overruns = 0;
+    int nb_polls = 0, nb_requests, s, e, i, rc;
+    bool finished = false;
+
+    if (nb_slaves < 1 || nb_slaves > SIM_MAX_SLAVES || baud == 0
+            || nb_entries < 1 || nb_entries > SIM_MAX_ENTRIES || cycles < 1
+            || nb_registers < 1 || nb_registers > MODBUS_MAX_READ_REGISTERS
+            || hole < 0 || nb_entries * (nb_registers + hole) > MODBUS_NB_TAB_REGISTER) {
+        fprintf(stderr, "usage: %s [slaves] [baud] [entries] [registers] [cycles] [proc_us] [gap] [hole]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    char_ticks = (uint64_t)MODBUS_HAL_TICKS_FREQUENCY * 11U / baud;
+    step = char_ticks / 4;
+    mb_hal_host_set_clock(sim_ticks);
+    sim_now = 1;
+
+    mb_mapping_init(&mapping);
+    for (i = 0; i < MODBUS_NB_TAB_REGISTER; i++) {
+        mapping.tab_registers[i] = i ^ 0x5A5A;
+    }
+    for (i = 0; i < MODBUS_NB_TAB_BIT; i++) {
+        MODBUS_SET_BIT(mapping.tab_bits, i, i % 3 == 0);
+    }
+    for (i = 0; i < MODBUS_NB_TAB_INPUT_BIT; i++) {
+        MODBUS_SET_BIT(mapping.tab_input_bits, i, i % 5 < 2);
+    }
+    for (s = 0; s < nb_slaves; s++) {
+        mb_init(&slaves[s], &mapping, &serial_slave, baud);
+        mb_set_slave(&slaves[s], s + 1);
+        for (e = 0; e < nb_entries; e++) {
+            mb_poll_t *poll = &polls[nb_polls++];
+
+            poll->slave = s + 1;
+            poll->function = MODBUS_FC_READ_HOLDING_REGISTERS;
+            poll->address = e * (nb_registers + hole);
+            poll->nb = nb_registers;
+            poll->period_ms = 0;
+            poll->dest = results[s];
+            poll->dest_index = e * nb_registers;
+        }
+        /* Same layout in the bit tables */
+        for (e = 0; e < 2 * nb_entries; e++) {
+            mb_poll_t *poll = &polls[nb_polls++];
+            bool input = e >= nb_entries;
+
+            poll->slave = s + 1;
+            poll->function = input ? MODBUS_FC_READ_DISCRETE_INPUTS : MODBUS_FC_READ_COILS;
+            poll->address = (e % nb_entries) * (nb_registers + hole);
+            poll->nb = nb_registers;
+            poll->period_ms = input ? SIM_PERIOD_MS : 0;
+            poll->dest = input ? inputs[s] : coils[s];
+            poll->dest_index = (e % nb_entries) * nb_registers;
+        }
+    }
+    absent_poll = &polls[nb_polls++];
+    absent_poll->slave = nb_slaves + 1;
+    absent_poll->function = MODBUS_FC_READ_HOLDING_REGISTERS;
+    absent_poll->nb = 1;
+    absent_poll->period_ms = SIM_ABSENT_PERIOD_MS;
+    absent_poll->dest = absent;
+    if (mb_master_init(&master, polls, nb_polls, &serial_master, baud) != 0
+            || mb_master_set_timeout(&master, absent_poll->slave, SIM_ABSENT_TIMEOUT_MS) != 0) {
+        fprintf(stderr, "invalid poll table\n");
+        return EXIT_FAILURE;
+    }
+    nb_requests = mb_master_plan(&master, gap);
+
+    t_start = sim_now;
+    while (!finished && sim_now - t_start < 600ULL * MODBUS_HAL_TICKS_FREQUENCY) {
+        uint64_t t = sim_now + step;
+
+        sim_deliver(t);
+        sim_now = t;
+        rc = mb_master_loop(&master);
+        if (rc > 0) {
+            exchanges++;
+        }
+        else if (rc < 0) {
+            failures++;
+        }
+        for (s = 0; s < nb_slaves; s++) {
+            sim_current = s;
+            mb_loop(&slaves[s]);
+        }
+
+        /* Periodic entries only have to come once */
+        finished = true;
+        for (i = 0; i < nb_polls; i++) {
+            if (polls[i].done + polls[i].errors < (polls[i].period_ms == 0 ? cycles : 1)) {
+                finished = false;
+                break;
+            }
+        }
+    }
+    t_end = sim_now;
+    elapsed_ms = (t_end - t_start) / (MODBUS_HAL_TICKS_FREQUENCY / 1000U);
+
+    /* A periodic entry goes once at start, then at most once a period */
+    for (i = 0; i < nb_polls; i++) {
+        if (polls[i].period_ms != 0
+                && polls[i].done + polls[i].errors > elapsed_ms / polls[i].period_ms + 1) {
+            overruns++;
+        }
+    }
+
+    for (s = 0; s < nb_slaves; s++) {
+        for (i = 0; i < nb_entries * nb_registers; i++) {
+            if (results[s][i] != mapping.tab_registers[i / nb_registers * (nb_registers + hole)
+                                                        + i % nb_registers]) {
+                mismatches++;
+            }
+        }
+        for (i = 0; i < nb_entries * nb_registers; i++) {
+            int bit = i / nb_registers * (nb_registers + hole) + i % nb_registers;
+
+            if (MODBUS_GET_BIT(coils[s], i) != MODBUS_GET_BIT(mapping.tab_bits, bit)
+                    || MODBUS_GET_BIT(inputs[s], i) != MODBUS_GET_BIT(mapping.tab_input_bits, bit)) {
+                mismatches++;
+            }
+        }
+    }
+
+    printf("%d slaves, %u baud, %d entries of %d registers each, processing %llu us\n",
+           nb_slaves, baud, nb_entries, nb_registers,
+           (unsigned long long)(proc_ticks / SIM_TICKS_PER_US));
+    printf("requests/cycle   %12d (gap %d, hole %d)\n", nb_requests, gap, hole);
+    printf("exchanges        %12u\n", exchanges);
+    printf("failures         %12u (%u timeouts, %u expected from slave %d)\n",
+           failures, master.timeouts, absent_poll->errors, absent_poll->slave);
+    printf("virtual time     %12.3f ms\n", (double)(t_end - t_start) / SIM_TICKS_PER_US / 1000.0);
+    printf("poll cycle       %12.3f ms for %d entries\n",
+           (double)(t_end - t_start) / cycles / SIM_TICKS_PER_US / 1000.0, nb_polls);
+    printf("requests/s       %12.1f\n", exchanges * (double)MODBUS_HAL_TICKS_FREQUENCY / (double)(t_end - t_start));
+    printf("bus utilisation  %12.1f %%\n", 100.0 * line_busy / (double)(t_end - t_start));
+    printf("collisions       %12u\n", collisions);
+    printf("mismatches       %12u\n", mismatches);
+    printf("period overruns  %12u\n", overruns);
+
+    /* Only the absent slave may fail, and only by timing out */
+    if (absent_poll->done != 0 || absent_poll->status != MODBUS_POLL_TIMEOUT
+            || master.timeouts != absent_poll->errors) {
+        failures++;
+    }
+    failures -= absent_poll->errors;
+
+    return !finished || failures || collisions || mismatches || overruns ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,42 @@
+/*
+ * File:   modbus-hal-host.c
+ * Author: thanho
+ *
+ * modbus-hal.h for POSIX hosts: ticks come from CLOCK_MONOTONIC scaled to
+ * MODBUS_HAL_TICKS_FREQUENCY, so the 32-bit counter wraps like the PIC32
+ * core timer does. A simulator can substitute its own clock.
+ */
+
+#include <stddef.h>
+#include <time.h>
+#include "modbus-hal-host.h"
+
+static uint32_t (*clock_ticks)(void);
+
+void mb_hal_host_set_clock(uint32_t (*ticks)(void))
+{
+    clock_ticks = ticks;
+}
+
+uint32_t mb_hal_ticks(void)
+{
+    struct timespec ts;
+
+    if (clock_ticks != NULL) {
+        return clock_ticks();
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * MODBUS_HAL_TICKS_FREQUENCY
+            + (uint64_t)ts.tv_nsec * (MODBUS_HAL_TICKS_FREQUENCY / 1000000U) / 1000U);
+}
+
+void mb_hal_delay_ms(uint32_t delay_ms)
+{
+    struct timespec ts;
+
+    ts.tv_sec = delay_ms / 1000U;
+    ts.tv_nsec = (long)(delay_ms % 1000U) * 1000000L;
+    while (nanosleep(&ts, &ts) != 0) {
+    }
+}
@@ -0,0 +1,27 @@
+/*
+ * File:   modbus-hal-host.h
+ * Author: thanho
+ *
+ * Host only extensions of modbus-hal.h
+ */
+
+#ifndef MODBUS_HAL_HOST_H
+#define	MODBUS_HAL_HOST_H
+
+#include "modbus-hal.h"
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+/**
+ * Replace the CLOCK_MONOTONIC tick source, eg. by a simulator virtual clock
+ * @param ticks returns MODBUS_HAL_TICKS_FREQUENCY ticks, NULL restores the default
+ */
+void mb_hal_host_set_clock(uint32_t (*ticks)(void));
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* MODBUS_HAL_HOST_H */
@@ -0,0 +1,176 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <unistd.h>
+#include "serial-posix.h"
+
+#define SERIAL_POSIX_RX_SIZE    MODBUS_MAX_ADU_LENGTH
+
+static int fd = -1;
+/* Bytes of the last bulk read not handed to the core yet */
+static uint8_t rx_buf[SERIAL_POSIX_RX_SIZE];
+static size_t rx_head;
+static size_t rx_tail;
+
+/* B0 for the rates termios has no constant for */
+static speed_t baud_to_speed(uint32_t baud)
+{
+    switch (baud) {
+    case 1200:      return B1200;
+    case 2400:      return B2400;
+    case 4800:      return B4800;
+    case 9600:      return B9600;
+    case 19200:     return B19200;
+    case 38400:     return B38400;
+    case 57600:     return B57600;
+    case 115200:    return B115200;
+    case 230400:    return B230400;
+#ifdef B460800
+    case 460800:    return B460800;
+    case 921600:    return B921600;
+    case 1000000:   return B1000000;
+    case 2000000:   return B2000000;
+    case 4000000:   return B4000000;
+#endif
+    default:        return B0;
+    }
+}
+
+int serial_posix_open(const char *path)
+{
+    int f = open(path, O_RDWR | O_NOCTTY | O_NONBLOCK);
+
+    if (f < 0) {
+        return -1;
+    }
+    serial_posix_attach(f);
+    return 0;
+}
+
+void serial_posix_attach(int f)
+{
+    serial_posix_close();
+    fd = f;
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+}
+
+bool serial_posix_is_open(void)
+{
+    return fd >= 0;
+}
+
+void serial_posix_close(void)
+{
+    if (fd >= 0) {
+        close(fd);
+        fd = -1;
+    }
+    rx_head = rx_tail = 0;
+}
+
+/* A tty that cannot run at baud is closed rather than left at another rate */
+static void posix_begin(uint32_t baud)
+{
+    speed_t speed = baud_to_speed(baud);
+    struct termios tio;
+
+    rx_head = rx_tail = 0;
+    if (speed == B0) {
+        serial_posix_close();
+        errno = EINVAL;
+        return;
+    }
+    if (tcgetattr(fd, &tio) != 0) {
+        serial_posix_close();
+        return;
+    }
+    /* 8N1, no echo, no line discipline, reads never block */
+    cfmakeraw(&tio);
+    tio.c_cflag |= CLOCAL | CREAD;
+    tio.c_cflag &= ~(CSTOPB | PARENB);
+    tio.c_cc[VMIN] = 0;
+    tio.c_cc[VTIME] = 0;
+    cfsetispeed(&tio, speed);
+    cfsetospeed(&tio, speed);
+    if (tcsetattr(fd, TCSANOW, &tio) != 0) {
+        serial_posix_close();
+    }
+}
+
+static size_t posix_available(void)
+{
+    if (rx_head == rx_tail) {
+        ssize_t n = read(fd, rx_buf, sizeof(rx_buf));
+
+        rx_tail = 0;
+        rx_head = n > 0 ? (size_t)n : 0;
+    }
+    return rx_head - rx_tail;
+}
+
+static uint8_t posix_read(void)
+{
+    if (posix_available() == 0) {
+        return 0;
+    }
+    return rx_buf[rx_tail++];
+}
+
+static void posix_write(uint8_t* buf, const size_t size)
+{
+    size_t done = 0;
+
+    while (done < size) {
+        ssize_t n = write(fd, buf + done, size - done);
+
+        if (n > 0) {
+            done += n;
+        }
+        else if (n < 0 && (errno == EAGAIN || errno == EINTR)) {
+            struct pollfd pfd = { .fd = fd, .events = POLLOUT };
+
+            poll(&pfd, 1, -1);
+        }
+        else {
+            return;
+        }
+    }
+}
+
+/* Nothing left in the kernel output queue */
+static bool posix_tx_complete(void)
+{
+    int pending;
+
+    return fd < 0 || (ioctl(fd, TIOCOUTQ, &pending) == 0 && pending == 0);
+}
+
+int serial_posix_wait(int timeout_ms)
+{
+    struct pollfd pfd = { .fd = fd, .events = POLLIN };
+    int rc;
+
+    if (rx_head != rx_tail) {
+        return rx_head - rx_tail;
+    }
+    if (fd < 0) {
+        errno = EBADF;
+        return -1;
+    }
+    do {
+        rc = poll(&pfd, 1, timeout_ms);
+    } while (rc < 0 && errno == EINTR);
+
+    return rc;
+}
+
+const serial_t serial_posix = {
+    .name           = "POSIX",
+    .begin          = posix_begin,
+    .available      = posix_available,
+    .read           = posix_read,
+    .write          = posix_write,
+    .tx_complete    = posix_tx_complete,
+};
@@ -0,0 +1,53 @@
+/*
+ * File:   serial-posix.h
+ * Author: thanho
+ *
+ * serial_t over a POSIX tty: a real serial port or one side of an openpty()
+ * pair. The descriptor is nonblocking, available() pulls everything the
+ * kernel holds with one read() and serial_posix_wait() sleeps in poll().
+ */
+
+#ifndef SERIAL_POSIX_H
+#define	SERIAL_POSIX_H
+
+#include "modbus-rtu.h"
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+extern const serial_t serial_posix;
+
+/**
+ * Open a tty device for serial_posix, begin() sets it raw at the baud rate
+ * @param path device, eg. /dev/ttyUSB0
+ * @return 0 on success, -1 with errno set
+ */
+int serial_posix_open(const char *path);
+
+/**
+ * Use an already open tty, eg. the slave side of openpty()
+ * @param fd descriptor, serial_posix closes it in serial_posix_close()
+ */
+void serial_posix_attach(int fd);
+
+/**
+ * @return true while a tty is attached, begin() closes it when the baud
+ *         rate is not supported or the tty refuses the settings
+ */
+bool serial_posix_is_open(void);
+
+void serial_posix_close(void);
+
+/**
+ * Wait for received bytes
+ * @param timeout_ms poll() timeout, -1 waits forever
+ * @return > 0 bytes ready, 0 timeout, -1 error
+ */
+int serial_posix_wait(int timeout_ms);
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* SERIAL_POSIX_H */
@@ -1,8 +1,8 @@
 #include "delay.h"
-#include "peripheral/coretimer/plib_coretimer.h"
+#include "modbus-hal.h"
 
 
 void delay(uint32_t delay_ms)
 {
-    CORETIMER_DelayMs(delay_ms);
+    mb_hal_delay_ms(delay_ms);
 }
@@ -0,0 +1,120 @@
+#include <stdio.h>
+#include "dlog.h"
+#include "modbus-hal.h"
+
+#if DLOG
+
+#if (DLOG_NB_EVENTS & (DLOG_NB_EVENTS - 1)) != 0
+#error "DLOG_NB_EVENTS must be a power of 2"
+#endif
+
+typedef struct _dlog_event_t {
+    uint32_t            ticks;
+    int32_t             arg[2];
+    uint8_t             code;
+} dlog_event_t;
+
+static const char *const formats[DLOG_NB_CODES] = {
+    [DLOG_MB_EXCHANGE_OK]    = "MODBUS RTU exchange successful, %ld bytes, port %ld\n",
+    [DLOG_MB_EXCHANGE_ERROR] = "MODBUS RTU exchange error, code = %ld, port %ld\n",
+    [DLOG_DROPPED]           = "%ld events dropped\n",
+};
+
+/* Written by dlog() only */
+static dlog_event_t events[DLOG_NB_EVENTS];
+static volatile uint32_t head = 0;
+static volatile uint32_t dropped = 0;
+/* Owned by dlog_task() */
+static volatile uint32_t tail = 0;
+static char line[DLOG_LINE_LENGTH];
+static int line_length = 0;
+static int line_sent = 0;
+
+static bool (*console_ready)(void) = NULL;
+static void (*console_put)(int c) = NULL;
+
+void dlog(uint8_t code, int32_t arg0, int32_t arg1)
+{
+    uint32_t h = head;
+    dlog_event_t *event;
+
+    if (console_put == NULL) {
+        return;
+    }
+    if (h - tail >= DLOG_NB_EVENTS) {
+        dropped++;
+        return;
+    }
+
+    event = &events[h & (DLOG_NB_EVENTS - 1)];
+    event->ticks = mb_hal_ticks();
+    event->code = code;
+    event->arg[0] = arg0;
+    event->arg[1] = arg1;
+    /* Publish the event once it is complete */
+    __atomic_store_n(&head, h + 1, __ATOMIC_RELEASE);
+}
+
+void dlog_init(bool (*ready)(void), void (*put)(int c))
+{
+    console_ready = ready;
+    console_put = put;
+}
+
+/* Format the oldest event, false if there is none */
+static bool format_next(void)
+{
+    uint32_t t = tail;
+    const dlog_event_t *event;
+    uint32_t lost;
+    unsigned long us;
+    int length;
+
+    if (t == __atomic_load_n(&head, __ATOMIC_ACQUIRE)) {
+        lost = __atomic_exchange_n(&dropped, 0, __ATOMIC_RELAXED);
+        if (lost == 0) {
+            return false;
+        }
+        length = snprintf(line, sizeof(line), formats[DLOG_DROPPED], (long)lost);
+    }
+    else {
+        event = &events[t & (DLOG_NB_EVENTS - 1)];
+        us = event->ticks / (MODBUS_HAL_TICKS_FREQUENCY / 1000000U);
+        length = snprintf(line, sizeof(line), "[%10lu] ", us);
+        if (event->code < DLOG_NB_CODES) {
+            length += snprintf(line + length, sizeof(line) - length,
+                    formats[event->code], (long)event->arg[0], (long)event->arg[1]);
+        }
+        else {
+            length += snprintf(line + length, sizeof(line) - length,
+                    "event %u %ld %ld\n", event->code, (long)event->arg[0], (long)event->arg[1]);
+        }
+        /* Free the slot */
+        __atomic_store_n(&tail, t + 1, __ATOMIC_RELEASE);
+    }
+
+    line_length = length < (int)sizeof(line) ? length : (int)sizeof(line) - 1;
+    line_sent = 0;
+    return true;
+}
+
+void dlog_task(void)
+{
+    if (console_put == NULL) {
+        return;
+    }
+
+    for (;;) {
+        if (line_sent == line_length && !format_next()) {
+            return;
+        }
+        while (line_sent < line_length) {
+            if (console_ready != NULL && !console_ready()) {
+                return;
+            }
+            console_put(line[line_sent++]);
+        }
+    }
+}
+
+#endif
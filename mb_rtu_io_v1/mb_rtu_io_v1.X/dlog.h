@@ -0,0 +1,71 @@
+/*
+ * File:   dlog.h
+ * Author: thanho
+ *
+ * Deferred binary event logger for the superloop
+ */
+
+#ifndef DLOG_H
+#define	DLOG_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Deferred logger: dlog() only stores a binary event (code, tick stamp, two
+   arguments) in a ring, dlog_task() formats and writes it out from the idle
+   part of the superloop without ever waiting on the console. With DLOG 0 the
+   calls compile to nothing */
+#ifndef DLOG
+#define DLOG                                        1
+#endif
+
+/* Events held until dlog_task() catches up, power of 2, the newest events are
+   dropped when the ring is full */
+#ifndef DLOG_NB_EVENTS
+#define DLOG_NB_EVENTS                              32
+#endif
+
+#define DLOG_LINE_LENGTH                            80
+
+/* Event codes, each one has a format taking the two arguments in dlog.c */
+#define DLOG_MB_EXCHANGE_OK                         0
+#define DLOG_MB_EXCHANGE_ERROR                      1
+#define DLOG_DROPPED                                2
+#define DLOG_NB_CODES                               3
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+#if DLOG
+/**
+ * Record an event, constant time, safe from one producer context
+ * @param code DLOG_* event code
+ * @param arg0 first format argument
+ * @param arg1 second format argument
+ */
+void dlog(uint8_t code, int32_t arg0, int32_t arg1);
+
+/**
+ * Set the console, events are discarded until it is set
+ * @param ready true when put() would not wait
+ * @param put writes one character
+ */
+void dlog_init(bool (*ready)(void), void (*put)(int c));
+
+/**
+ * Drain as much of the pending output as the console takes without waiting,
+ * call it from the idle part of the loop
+ */
+void dlog_task(void);
+#else
+#define dlog(code, arg0, arg1)                      do { } while (0)
+#define dlog_init(ready, put)                       do { } while (0)
+#define dlog_task()                                 do { } while (0)
+#endif
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* DLOG_H */
@@ -1,44 +1,242 @@
 #include "ioctl.h"
 #include "modbus-rtu.h"
 #include "peripheral/gpio/plib_gpio.h"
+#include "peripheral/tmr/plib_tmr3.h"
 
 
-#define _IOCTL_NB_BITS      3
+#define _IOCTL_NB_PORTS     (GPIO_PORT_K + 1)
 
+typedef struct _ioctl_pin_t {
+    uint16_t    index;
+    GPIO_PIN    pin;
+} ioctl_pin_t;
 
+/* Coil index in tab_bits driving each output pin, in any order */
+static const ioctl_pin_t outputs[] = {
+    { 0, GPIO_LED_1_PIN },
+    { 1, GPIO_LED_2_PIN },
+    { 2, GPIO_LED_3_PIN },
+};
 
-static void ioctl_mapping_tab_bits(void)
+/* Discrete input index in tab_input_bits read from each pin, in any order,
+   starter kit SW1 and SW2 (low when pressed), SW3 shares RB14 with U2TX */
+static const ioctl_pin_t inputs[] = {
+    { 0, GPIO_PIN_RB12 },
+    { 1, GPIO_PIN_RB13 },
+};
+
+#define _IOCTL_NB_OUTPUTS   (sizeof(outputs) / sizeof(outputs[0]))
+#define _IOCTL_NB_INPUTS    (sizeof(inputs) / sizeof(inputs[0]))
+
+/* The tables regrouped by port by ioctl_init() */
+typedef struct _ioctl_bit_t {
+    uint16_t    index;
+    uint16_t    mask;
+} ioctl_bit_t;
+
+typedef struct _ioctl_port_t {
+    GPIO_PORT   port;
+    uint32_t    mask;
+    uint8_t     first;
+    uint8_t     count;
+} ioctl_port_t;
+
+/* 2-bit vertical counter per pin, a pin flips after 4 equal samples */
+typedef struct _ioctl_debounce_t {
+    uint32_t    state;
+    uint32_t    cnt0;
+    uint32_t    cnt1;
+} ioctl_debounce_t;
+
+static ioctl_bit_t output_bits[_IOCTL_NB_OUTPUTS];
+static ioctl_port_t output_ports[_IOCTL_NB_PORTS];
+static uint8_t nb_output_ports = 0;
+
+static ioctl_bit_t input_bits[_IOCTL_NB_INPUTS];
+static ioctl_port_t input_ports[_IOCTL_NB_PORTS];
+static ioctl_debounce_t debounce[_IOCTL_NB_PORTS];
+static uint8_t nb_input_ports = 0;
+
+/* Tables of the context given to ioctl_init() */
+static mb_mapping_t *mapping;
+
+
+
+/**
+ * Group a pin table by port
+ * @param pins pin table
+ * @param nb_pins number of pins
+ * @param nb_index size of the mapping table, pins beyond are ignored
+ * @param bits receives the pins in port order
+ * @param ports receives the ports used
+ * @return number of ports used
+ */
+static uint8_t ioctl_group(const ioctl_pin_t *pins, size_t nb_pins, uint16_t nb_index,
+                           ioctl_bit_t *bits, ioctl_port_t *ports)
+{
+    GPIO_PORT port;
+    uint8_t nb_ports = 0;
+    uint8_t n = 0;
+    size_t i;
+
+    for (port = GPIO_PORT_A; port < _IOCTL_NB_PORTS; port++) {
+        uint32_t mask = 0;
+        uint8_t first = n;
+
+        for (i = 0; i < nb_pins; i++) {
+            if ((pins[i].pin >> 4U) != port || pins[i].index >= nb_index) {
+                continue;
+            }
+            bits[n].index = pins[i].index;
+            bits[n].mask = (uint16_t)(1U << (pins[i].pin & 0xFU));
+            mask |= bits[n].mask;
+            n++;
+        }
+        if (n > first) {
+            ports[nb_ports].port = port;
+            ports[nb_ports].mask = mask;
+            ports[nb_ports].first = first;
+            ports[nb_ports].count = n - first;
+            nb_ports++;
+        }
+    }
+
+    return nb_ports;
+}
+
+
+/* Push the outputs driven by coils index to index + nb - 1 */
+static void ioctl_mapping_tab_bits(int index, int nb)
 {
-    uint8_t nb_bit = 0;
-    
-    for (nb_bit = start_bits; nb_bit < nb_bits; nb_bit++) {
-        if (nb_bit >= _IOCTL_NB_BITS) break;
-        switch (nb_bit) {
-            case 0:
-                if (tab_bits[nb_bit]) GPIO_LED_1_Set(); else GPIO_LED_1_Clear();
-                break;
-            case 1:
-                if (tab_bits[nb_bit]) GPIO_LED_2_Set(); else GPIO_LED_2_Clear();
-                break;
-            case 2:
-                if (tab_bits[nb_bit]) GPIO_LED_3_Set(); else GPIO_LED_3_Clear();
-                break;
-            default:
-                break;
-        }        
+    uint8_t p, i;
+
+    for (p = 0; p < nb_output_ports; p++) {
+        const ioctl_port_t *port = &output_ports[p];
+        uint32_t set = 0;
+        uint32_t clear = 0;
+
+        for (i = port->first; i < port->first + port->count; i++) {
+            if (output_bits[i].index < index || output_bits[i].index >= index + nb) {
+                continue;
+            }
+            if (MODBUS_GET_BIT(mapping->tab_bits, output_bits[i].index)) {
+                set |= output_bits[i].mask;
+            }
+            else {
+                clear |= output_bits[i].mask;
+            }
+        }
+        /* One LATxSET and one LATxCLR store per port, none if untouched */
+        if (set != 0) {
+            GPIO_PortSet(port->port, set);
+        }
+        if (clear != 0) {
+            GPIO_PortClear(port->port, clear);
+        }
     }
 }
 
 
-void ioctl_init(void)
+/* Copy the debounced pins of a port that changed to tab_input_bits */
+static void ioctl_publish_input_bits(uint8_t p, uint32_t changed)
 {
-    ;
+    const ioctl_port_t *port = &input_ports[p];
+    uint32_t state = debounce[p].state;
+    uint8_t i;
+
+    for (i = port->first; i < port->first + port->count; i++) {
+        if (changed & input_bits[i].mask) {
+            MODBUS_SET_BIT(mapping->tab_input_bits, input_bits[i].index, state & input_bits[i].mask);
+        }
+    }
+}
+
+
+/* TMR3 interrupt, samples every input port and debounces all pins of a port
+   at once */
+static void ioctl_sample(uint32_t status, uintptr_t context)
+{
+    uint8_t p;
+
+    for (p = 0; p < nb_input_ports; p++) {
+        ioctl_debounce_t *d = &debounce[p];
+        uint32_t sample = GPIO_PortRead(input_ports[p].port) & input_ports[p].mask;
+        uint32_t delta = sample ^ d->state;
+        uint32_t toggle;
+
+        /* Count the samples differing from the state, reset on equal ones */
+        d->cnt1 = (d->cnt1 ^ d->cnt0) & delta;
+        d->cnt0 = ~d->cnt0 & delta;
+        /* Flip the pins whose counter wrapped */
+        toggle = delta & ~(d->cnt0 | d->cnt1);
+        if (toggle != 0) {
+            d->state ^= toggle;
+            ioctl_publish_input_bits(p, toggle);
+        }
+    }
+}
+
+
+/* Called by mb_reply() before the response goes out, writes to the other
+   units of the port leave the pins alone */
+static void ioctl_write(mb_t *mb, int table, int index, int nb)
+{
+    if (table == MODBUS_TABLE_BITS && mb->unit == mapping) {
+        ioctl_mapping_tab_bits(index, nb);
+    }
+}
+
+
+void ioctl_init(mb_t *mb)
+{
+    uint8_t p;
+
+    mapping = mb->mapping;
+
+    nb_output_ports = ioctl_group(outputs, _IOCTL_NB_OUTPUTS, MODBUS_NB_TAB_BIT,
+                                  output_bits, output_ports);
+    for (p = 0; p < nb_output_ports; p++) {
+        GPIO_PortOutputEnable(output_ports[p].port, output_ports[p].mask);
+    }
+    ioctl_mapping_tab_bits(0, MODBUS_NB_TAB_BIT);
+    mb_set_write_handler(mb, ioctl_write);
+
+    nb_input_ports = ioctl_group(inputs, _IOCTL_NB_INPUTS, MODBUS_NB_TAB_INPUT_BIT,
+                                 input_bits, input_ports);
+    for (p = 0; p < nb_input_ports; p++) {
+        GPIO_PORT port = input_ports[p].port;
+        uint32_t mask = input_ports[p].mask;
+
+        /* Digital input with pull-up */
+        *(volatile uint32_t *)(&ANSELACLR + (port * 0x40U)) = mask;
+        *(volatile uint32_t *)(&CNPUASET + (port * 0x40U)) = mask;
+        GPIO_PortInputEnable(port, mask);
+        /* Start from the current levels */
+        debounce[p].state = GPIO_PortRead(port) & mask;
+        debounce[p].cnt0 = 0;
+        debounce[p].cnt1 = 0;
+        ioctl_publish_input_bits(p, mask);
+    }
+    if (nb_input_ports > 0) {
+        TMR3_CallbackRegister(ioctl_sample, 0);
+        TMR3_Start();
+    }
+}
+
+
+void ioctl_attach(mb_t *mb)
+{
+    if (mb->mapping == mapping) {
+        mb_set_write_handler(mb, ioctl_write);
+    }
 }
 
 
 void ioctl_loop(void)
 {
-    ioctl_mapping_tab_bits();
+    /* Outputs follow the writes through ioctl_write(), inputs are sampled
+       by the TMR3 interrupt */
+    ;
 }
 
 
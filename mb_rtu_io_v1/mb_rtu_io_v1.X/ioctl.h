@@ -8,13 +8,17 @@
 #ifndef IOCTL_H
 #define	IOCTL_H
 
+#include "modbus-rtu.h"
 
 #ifdef	__cplusplus
 extern "C" {
 #endif
 
 
-void ioctl_init(void);
+void ioctl_init(mb_t *mb);
+/* Drive the outputs from the writes of another context, only if it shares
+   the mapping given to ioctl_init() */
+void ioctl_attach(mb_t *mb);
 void ioctl_loop(void);
 
 
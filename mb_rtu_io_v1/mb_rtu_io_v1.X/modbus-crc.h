@@ -0,0 +1,40 @@
+/*
+ * File:   modbus-crc.h
+ * Author: thanho
+ *
+ * CRC-16/MODBUS engines, bitwise, nibble table and byte table
+ */
+
+#ifndef MODBUS_CRC_H
+#define	MODBUS_CRC_H
+
+#include <stdint.h>
+
+/* CRC engines, pick one with MODBUS_CRC_ENGINE at build time */
+#define MODBUS_CRC_ENGINE_BITWISE                   0
+#define MODBUS_CRC_ENGINE_NIBBLE                    1
+#define MODBUS_CRC_ENGINE_TABLE                     2
+
+#ifndef MODBUS_CRC_ENGINE
+#define MODBUS_CRC_ENGINE                           MODBUS_CRC_ENGINE_TABLE
+#endif
+
+#define MODBUS_CRC_INIT                             0xFFFF
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+uint16_t crc16(const uint8_t *buf, uint16_t length);
+uint16_t crc16_update(uint16_t crc, uint8_t c);
+
+/* Only the selected engine is built, unless MODBUS_CRC_ALL_ENGINES is defined */
+uint16_t crc16_table(const uint8_t *buf, uint16_t length);
+uint16_t crc16_nibble(const uint8_t *buf, uint16_t length);
+uint16_t crc16_bitwise(const uint8_t *buf, uint16_t length);
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* MODBUS_CRC_H */
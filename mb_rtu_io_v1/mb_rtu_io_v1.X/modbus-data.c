@@ -55,6 +55,78 @@ uint8_t modbus_get_byte_from_bits(const uint8_t *src, int idx, unsigned int nb_b
     return value;
 }
 
+/* Packs nb_bits bits of a bitmap, starting at idx, into bytes in Modbus
+   order (first bit in the LSB of the first byte). Bits are extracted a
+   word at a time, an unaligned idx is funnel shifted across two words.
+   Returns the number of bytes written. */
+int modbus_bitmap_get_bytes(const uint32_t *src,
+                            int idx,
+                            unsigned int nb_bits,
+                            uint8_t *dest)
+{
+    const uint32_t *word = src + (idx >> 5);
+    unsigned int shift = idx & 31;
+    unsigned int nb_bytes = (nb_bits + 7) / 8;
+    unsigned int i;
+    uint32_t value = 0;
+
+    for (i = 0; i < nb_bytes; i++) {
+        if ((i & 3) == 0) {
+            value = word[0] >> shift;
+            if (shift != 0) {
+                value |= word[1] << (32 - shift);
+            }
+            word++;
+        }
+        dest[i] = value & 0xFF;
+        value >>= 8;
+    }
+
+    /* Unused bits of the last byte are zero */
+    if (nb_bits & 7) {
+        dest[nb_bytes - 1] &= (1U << (nb_bits & 7)) - 1;
+    }
+
+    return nb_bytes;
+}
+
+/* Stores nb_bits bits from Modbus ordered bytes into a bitmap at idx, 32 bits
+   per step with a masked merge so bits around the range are kept. */
+void modbus_bitmap_set_bytes(uint32_t *dest,
+                             int idx,
+                             unsigned int nb_bits,
+                             const uint8_t *tab_byte)
+{
+    uint32_t *word = dest + (idx >> 5);
+    unsigned int shift = idx & 31;
+    unsigned int done;
+
+    for (done = 0; done < nb_bits; done += 32) {
+        unsigned int n = nb_bits - done;
+        unsigned int i;
+        uint32_t mask;
+        uint32_t value = 0;
+
+        if (n > 32) {
+            n = 32;
+        }
+        mask = (n == 32) ? 0xFFFFFFFFU : ((1U << n) - 1);
+
+        for (i = 0; i < (n + 7) / 8; i++) {
+            value |= (uint32_t)tab_byte[i] << (8 * i);
+        }
+        value &= mask;
+        tab_byte += 4;
+
+        word[0] = (word[0] & ~(mask << shift)) | (value << shift);
+        if (shift != 0 && (mask >> (32 - shift)) != 0) {
+            /* The range spills into the next word */
+            word[1] = (word[1] & ~(mask >> (32 - shift))) | (value >> (32 - shift));
+        }
+        word++;
+    }
+}
+
 /* Get a float from 4 bytes (Modbus) without any conversion (ABCD) */
 float modbus_get_float_abcd(const uint16_t *src)
 {
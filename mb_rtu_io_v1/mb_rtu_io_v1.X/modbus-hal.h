@@ -0,0 +1,40 @@
+/*
+ * File:   modbus-hal.h
+ * Author: thanho
+ *
+ * Tick counter and delay the protocol core needs from the platform
+ */
+
+#ifndef MODBUS_HAL_H
+#define	MODBUS_HAL_H
+
+#include <stdint.h>
+
+/* Hardware the protocol core needs besides the serial_t line: a free running
+   32-bit tick counter for the RTU silent intervals and a blocking delay. On
+   the PIC32 they map to the core timer, other builds link an implementation
+   such as host/modbus-hal-host.c */
+#ifdef __XC32
+#include "peripheral/coretimer/plib_coretimer.h"
+
+#define MODBUS_HAL_TICKS_FREQUENCY                  CORE_TIMER_FREQUENCY
+#define mb_hal_ticks()                              CORETIMER_CounterGet()
+#define mb_hal_delay_ms(delay_ms)                   CORETIMER_DelayMs(delay_ms)
+#else
+#define MODBUS_HAL_TICKS_FREQUENCY                  100000000U
+#endif
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+#ifndef __XC32
+uint32_t mb_hal_ticks(void);
+void mb_hal_delay_ms(uint32_t delay_ms);
+#endif
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* MODBUS_HAL_H */
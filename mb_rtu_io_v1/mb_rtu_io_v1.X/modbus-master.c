@@ -0,0 +1,451 @@
+#include <stddef.h>
+#include <string.h>
+#include "modbus-master.h"
+#include "modbus-crc.h"
+#include "modbus-hal.h"
+
+#define _MASTER_MS_TICKS                            (MODBUS_HAL_TICKS_FREQUENCY / 1000U)
+/* Slave, function, address, quantity */
+#define _MASTER_REQ_LENGTH                          6
+/* Slave, function, byte count or exception code, CRC */
+#define _MASTER_RSP_MIN_LENGTH                      5
+
+#if MODBUS_MASTER_TIMEOUT_MS > MODBUS_MASTER_MAX_MS
+#error "MODBUS_MASTER_TIMEOUT_MS is above MODBUS_MASTER_MAX_MS"
+#endif
+
+
+/* The serial handlers are given the embedded line context */
+static inline mb_master_t *master_of(mb_t *mb)
+{
+    return (mb_master_t *)((uint8_t *)mb - offsetof(mb_master_t, mb));
+}
+
+/**
+ * Store one received byte, from the RX interrupt or from mb_master_loop() for
+ * polled backends. Bytes outside an exchange only keep the line busy.
+ * @param mb line context
+ * @param c received byte
+ */
+static void master_rx_feed(mb_t *mb, uint8_t c)
+{
+    uint16_t length = mb->rx.length;
+
+    mb->rx.last_ticks = mb_hal_ticks();
+    if (!master_of(mb)->listening || length >= MODBUS_MAX_ADU_LENGTH) {
+        return;
+    }
+    mb->rx.adu[length] = c;
+    /* Publish the byte once it is stored */
+    __atomic_store_n(&mb->rx.length, length + 1, __ATOMIC_RELEASE);
+}
+
+/* Whole frame from backends that delimit them, copied so the backend keeps
+   its buffer */
+static bool master_rx_frame(mb_t *mb, uint8_t *adu, uint16_t length)
+{
+    mb->rx.last_ticks = mb_hal_ticks();
+    if (!master_of(mb)->listening || mb->rx.length != 0) {
+        return false;
+    }
+    if (length > MODBUS_MAX_ADU_LENGTH) {
+        length = MODBUS_MAX_ADU_LENGTH;
+    }
+    memcpy(mb->rx.adu, adu, length);
+    __atomic_store_n(&mb->rx.length, length, __ATOMIC_RELEASE);
+    return false;
+}
+
+/* Line errors spoil the response being received */
+static void master_rx_error(mb_t *mb, uint32_t errors)
+{
+    if (errors & MODBUS_SERIAL_ERROR_OVERRUN) {
+        mb->counters.bus_char_overrun++;
+    }
+    if (master_of(mb)->listening) {
+        mb->rx.broken = true;
+    }
+}
+
+/* Lead entry due first from now, equal ones go round robin after the last
+   one sent, whether it was answered or not */
+static int16_t master_pick(mb_master_t *master, uint32_t now)
+{
+    int16_t best = -1;
+    int32_t best_wait = 0;
+    uint16_t i;
+
+    for (i = 1; i <= master->nb_polls; i++) {
+        int16_t index = (master->last + i) % master->nb_polls;
+        int32_t wait = (int32_t)(master->polls[index].due_ticks - now);
+
+        if (master->polls[index].lead != index) {
+            continue;
+        }
+        if (best < 0 || wait < best_wait) {
+            best = index;
+            best_wait = wait;
+        }
+    }
+
+    return best;
+}
+
+/* Build the request of an entry in the TX buffer, CRC included */
+static void master_build(mb_master_t *master, int16_t index)
+{
+    const mb_poll_t *poll = &master->polls[index];
+    uint8_t *req = master->mb.rsp_adu;
+    uint16_t crc;
+
+    req[0] = poll->slave;
+    req[1] = poll->function;
+    req[2] = poll->req_address >> 8;
+    req[3] = poll->req_address & 0xFF;
+    req[4] = poll->req_nb >> 8;
+    req[5] = poll->req_nb & 0xFF;
+    crc = crc16(req, _MASTER_REQ_LENGTH);
+    req[6] = crc >> 8;
+    req[7] = crc & 0xFF;
+    master->req_length = _MASTER_REQ_LENGTH + MODBUS_RTU_CHECKSUM_LENGTH;
+    master->next = index;
+}
+
+/* Put the built request on the line and wait for the response */
+static void master_send(mb_master_t *master, uint32_t now)
+{
+    mb_t *mb = &master->mb;
+    mb_poll_t *poll = &master->polls[master->next];
+    uint32_t period_ticks = poll->period_ms * _MASTER_MS_TICKS;
+    uint16_t timeout_ms = master->timeout_ms[poll->slave];
+    uint32_t end_ticks = now + master->req_length * mb->rx.char_ticks;
+
+    /* An entry that fell behind is not sent again at once */
+    poll->due_ticks += period_ticks;
+    if ((int32_t)(now - poll->due_ticks) > 0) {
+        poll->due_ticks = now + period_ticks;
+    }
+
+    master->current = master->next;
+    master->last = master->next;
+    master->next = -1;
+    master->rsp_expected = (poll->function <= MODBUS_FC_READ_DISCRETE_INPUTS)
+            ? (poll->req_nb + 7) / 8 : poll->req_nb * 2;
+    master->deadline_ticks = end_ticks
+            + (timeout_ms != 0 ? timeout_ms : MODBUS_MASTER_TIMEOUT_MS) * _MASTER_MS_TICKS;
+
+    /* The line is busy until the request is out */
+    mb->rx.last_ticks = end_ticks;
+    mb->rx.length = 0;
+    mb->rx.broken = false;
+    __atomic_store_n(&master->listening, true, __ATOMIC_RELEASE);
+    mb->serial->write(mb->rsp_adu, master->req_length);
+}
+
+/* End the exchange of current on an error, for every entry it carries */
+static int master_fail(mb_master_t *master, uint8_t status)
+{
+    int16_t index;
+
+    __atomic_store_n(&master->listening, false, __ATOMIC_RELEASE);
+    for (index = master->current; index >= 0; index = master->polls[index].link) {
+        master->polls[index].status = status;
+        master->polls[index].errors++;
+    }
+    master->current = -1;
+    return -status;
+}
+
+/* Copy the part of a response data field read for one entry */
+static void master_scatter(const mb_poll_t *lead, const mb_poll_t *poll, const uint8_t *data)
+{
+    uint16_t offset = poll->address - lead->req_address;
+    uint16_t i;
+
+    if (poll->function <= MODBUS_FC_READ_DISCRETE_INPUTS) {
+        uint32_t *bits = (uint32_t *)poll->dest;
+
+        if ((offset & 7) == 0) {
+            modbus_bitmap_set_bytes(bits, poll->dest_index, poll->nb, &data[offset >> 3]);
+        }
+        else {
+            for (i = 0; i < poll->nb; i++) {
+                uint16_t bit = offset + i;
+
+                MODBUS_SET_BIT(bits, poll->dest_index + i, (data[bit >> 3] >> (bit & 7)) & 1U);
+            }
+        }
+    }
+    else {
+        uint16_t *registers = (uint16_t *)poll->dest + poll->dest_index;
+
+        data += 2 * offset;
+        for (i = 0; i < poll->nb; i++) {
+            registers[i] = (data[2 * i] << 8) + data[2 * i + 1];
+        }
+    }
+}
+
+/**
+ * Check a complete response and copy its data to the destinations of the
+ * entries it carries
+ * @param master context
+ * @param length response length including CRC
+ * @return length, or -MODBUS_POLL_* on error
+ */
+static int master_finish(mb_master_t *master, uint16_t length)
+{
+    mb_t *mb = &master->mb;
+    mb_poll_t *poll = &master->polls[master->current];
+    const uint8_t *rsp = mb->rx.adu;
+    uint8_t status;
+    int16_t index;
+
+    if (mb->rx.broken || crc16(rsp, length) != 0) {
+        mb->counters.bus_comm_error++;
+        status = MODBUS_POLL_BAD_CRC;
+    }
+    else if (rsp[0] != poll->slave || (rsp[1] & 0x7F) != poll->function) {
+        status = MODBUS_POLL_BAD_FRAME;
+    }
+    else if (rsp[1] & 0x80) {
+        mb->counters.bus_exception++;
+        for (index = master->current; index >= 0; index = master->polls[index].link) {
+            master->polls[index].exception = rsp[2];
+        }
+        status = MODBUS_POLL_EXCEPTION;
+    }
+    else if (rsp[2] != master->rsp_expected) {
+        status = MODBUS_POLL_BAD_FRAME;
+    }
+    else {
+        status = MODBUS_POLL_OK;
+    }
+
+    if (status != MODBUS_POLL_OK) {
+        return master_fail(master, status);
+    }
+    for (index = master->current; index >= 0; index = master->polls[index].link) {
+        mb_poll_t *member = &master->polls[index];
+
+        master_scatter(poll, member, &rsp[3]);
+        member->status = status;
+        member->done++;
+    }
+    __atomic_store_n(&master->listening, false, __ATOMIC_RELEASE);
+    master->current = -1;
+    mb->counters.bus_message++;
+    return length;
+}
+
+int mb_master_init(mb_master_t *master, mb_poll_t *polls, uint16_t nb_polls,
+                   const serial_t *port, int baud)
+{
+    mb_t *mb = &master->mb;
+    uint32_t now;
+    uint16_t i;
+
+    memset(master, 0, sizeof(*master));
+    master->current = -1;
+    master->next = -1;
+    master->last = -1;
+    for (i = 0; i < nb_polls; i++) {
+        const mb_poll_t *poll = &polls[i];
+        uint16_t max = (poll->function <= MODBUS_FC_READ_DISCRETE_INPUTS)
+                ? MODBUS_MAX_READ_BITS : MODBUS_MAX_READ_REGISTERS;
+
+        if (poll->slave == MODBUS_BROADCAST_ADDRESS || poll->slave >= MODBUS_NB_SLAVE_IDS
+                || poll->function < MODBUS_FC_READ_COILS
+                || poll->function > MODBUS_FC_READ_INPUT_REGISTERS
+                || poll->nb < 1 || poll->nb > max || poll->dest == NULL
+                || (uint32_t)poll->address + poll->nb > 0x10000U
+                || poll->period_ms > MODBUS_MASTER_MAX_MS) {
+            return -1;
+        }
+    }
+
+    master->polls = polls;
+    master->nb_polls = nb_polls;
+    mb->slave = -1;
+    MODBUS_DMA_FLUSH(mb->rsp_buffer, sizeof(mb->rsp_buffer));
+    mb->rsp_adu = MODBUS_DMA_ALIAS(mb->rsp_buffer);
+    mb_set_rx_timing(mb, baud);
+
+    now = mb_hal_ticks();
+    for (i = 0; i < nb_polls; i++) {
+        polls[i].due_ticks = now;
+        polls[i].done = 0;
+        polls[i].errors = 0;
+        polls[i].status = MODBUS_POLL_PENDING;
+    }
+    mb_master_plan(master, -1);
+    /* The first request waits for a T3.5 silence too */
+    mb->rx.last_ticks = now;
+
+    mb->serial = port;
+    mb->serial->begin(baud);
+    if (mb->serial->set_frame_handler != NULL) {
+        mb->serial->set_frame_handler(master_rx_frame, mb);
+    }
+    else if (mb->serial->set_rx_handler != NULL) {
+        mb->serial->set_rx_handler(master_rx_feed, mb);
+    }
+    if (mb->serial->set_error_handler != NULL) {
+        mb->serial->set_error_handler(master_rx_error, mb);
+    }
+    return 0;
+}
+
+int mb_master_plan(mb_master_t *master, int gap)
+{
+    mb_poll_t *polls = master->polls;
+    int16_t nb_polls = master->nb_polls;
+    int nb_requests = 0;
+    int16_t i, j;
+
+    /* Not while a request is on the wire, a built one is built again */
+    if (master->current >= 0) {
+        return -1;
+    }
+    master->next = -1;
+
+    for (i = 0; i < nb_polls; i++) {
+        polls[i].lead = (gap < 0) ? i : -1;
+        polls[i].link = -1;
+        polls[i].req_address = polls[i].address;
+        polls[i].req_nb = polls[i].nb;
+    }
+    if (gap < 0) {
+        return nb_polls;
+    }
+
+    for (i = 0; i < nb_polls; i++) {
+        const mb_poll_t *key = &polls[i];
+        uint16_t max = (key->function <= MODBUS_FC_READ_DISCRETE_INPUTS)
+                ? MODBUS_MAX_READ_BITS : MODBUS_MAX_READ_REGISTERS;
+        int16_t head = i;
+        int16_t last = -1;
+        int16_t index;
+        uint32_t end = 0;
+
+        if (key->lead >= 0) {
+            continue;
+        }
+
+        /* Chain the entries sharing the request key by address */
+        polls[i].lead = i;
+        for (j = i + 1; j < nb_polls; j++) {
+            int16_t *prev = &head;
+
+            if (polls[j].lead >= 0 || polls[j].slave != key->slave
+                    || polls[j].function != key->function
+                    || polls[j].period_ms != key->period_ms) {
+                continue;
+            }
+            while (*prev >= 0 && polls[*prev].address <= polls[j].address) {
+                prev = &polls[*prev].link;
+            }
+            polls[j].link = *prev;
+            polls[j].lead = i;
+            *prev = j;
+        }
+
+        /* Cut the chain into requests, greedily extended while the range
+           stays readable at once */
+        index = head;
+        head = -1;
+        while (index >= 0) {
+            mb_poll_t *poll = &polls[index];
+            int16_t link = poll->link;
+            uint32_t poll_end = (uint32_t)poll->address + poll->nb;
+
+            if (head >= 0 && poll->address <= end + (uint32_t)gap
+                    && (poll_end > end ? poll_end : end) - polls[head].req_address <= max) {
+                poll->lead = head;
+                if (poll_end > end) {
+                    end = poll_end;
+                }
+                polls[head].req_nb = end - polls[head].req_address;
+            }
+            else {
+                /* The previous request ends with the entry before */
+                if (last >= 0) {
+                    polls[last].link = -1;
+                }
+                head = index;
+                poll->lead = index;
+                end = poll_end;
+                nb_requests++;
+            }
+            last = index;
+            index = link;
+        }
+    }
+
+    return nb_requests;
+}
+
+int mb_master_set_timeout(mb_master_t *master, uint8_t slave, uint16_t timeout_ms)
+{
+    if (slave == MODBUS_BROADCAST_ADDRESS || slave >= MODBUS_NB_SLAVE_IDS
+            || timeout_ms > MODBUS_MASTER_MAX_MS) {
+        return -1;
+    }
+    master->timeout_ms[slave] = timeout_ms;
+    return 0;
+}
+
+int mb_master_loop(mb_master_t *master)
+{
+    mb_t *mb = &master->mb;
+    uint32_t now;
+    int rc = 0;
+
+    if (master->nb_polls == 0) {
+        return 0;
+    }
+
+    /* Backends without RX interrupt are drained here */
+    if (mb->serial->set_rx_handler == NULL && mb->serial->set_frame_handler == NULL) {
+        while (mb->serial->available()) {
+            master_rx_feed(mb, mb->serial->read());
+        }
+    }
+    now = mb_hal_ticks();
+
+    if (master->current >= 0) {
+        uint16_t length = __atomic_load_n(&mb->rx.length, __ATOMIC_ACQUIRE);
+        /* The byte count gives the length once the header is in */
+        uint16_t needed = (length >= 3 && !(mb->rx.adu[1] & 0x80))
+                ? _MASTER_RSP_MIN_LENGTH + mb->rx.adu[2] : _MASTER_RSP_MIN_LENGTH;
+
+        if (length >= needed) {
+            rc = master_finish(master, needed);
+        }
+        else if (length > 0) {
+            /* The timeout only covers the wait for the first byte, a
+               response cut by a T3.5 silence is dropped */
+            if ((int32_t)(now - mb->rx.last_ticks) > (int32_t)mb->rx.t35_ticks) {
+                rc = master_fail(master, MODBUS_POLL_BAD_FRAME);
+            }
+        }
+        else if ((int32_t)(now - master->deadline_ticks) >= 0) {
+            master->timeouts++;
+            rc = master_fail(master, MODBUS_POLL_TIMEOUT);
+        }
+    }
+
+    /* The next request is built while the response is on its way, once the
+       backend is done with the previous one */
+    if (master->next < 0 && !(mb->serial->tx_busy != NULL && mb->serial->tx_busy())) {
+        master_build(master, master_pick(master, now));
+    }
+
+    if (master->current < 0 && master->next >= 0
+            && (int32_t)(now - master->polls[master->next].due_ticks) >= 0
+            && (int32_t)(now - mb->rx.last_ticks) >= (int32_t)mb->rx.t35_ticks) {
+        master_send(master, now);
+    }
+
+    return rc;
+}
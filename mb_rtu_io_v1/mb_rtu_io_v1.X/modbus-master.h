@@ -0,0 +1,131 @@
+/*
+ * File:   modbus-master.h
+ * Author: thanho
+ *
+ * RTU master polling a table of reads on one serial port
+ */
+
+#ifndef MODBUS_MASTER_H
+#define	MODBUS_MASTER_H
+
+#include "modbus-rtu.h"
+#include "modbus-hal.h"
+
+/* Response timeout of the slaves without one of their own */
+#ifndef MODBUS_MASTER_TIMEOUT_MS
+#define MODBUS_MASTER_TIMEOUT_MS                    100
+#endif
+
+/* Longest period and response timeout, deadlines are compared as int32_t
+   tick differences and must stay below 2^31 ticks with a request on top of
+   them, 20.4 s at 100 MHz */
+#define MODBUS_MASTER_MAX_MS                        (INT32_MAX / (MODBUS_HAL_TICKS_FREQUENCY / 1000U) - 1000U)
+
+/* Outcome of the last request of a poll entry */
+#define MODBUS_POLL_PENDING                         0
+#define MODBUS_POLL_OK                              1
+#define MODBUS_POLL_TIMEOUT                         2
+#define MODBUS_POLL_BAD_CRC                         3
+#define MODBUS_POLL_BAD_FRAME                       4
+#define MODBUS_POLL_EXCEPTION                       5
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+/* One read sent every period, FC 0x01 to 0x04 */
+typedef struct _mb_poll_t {
+    uint8_t             slave;
+    uint8_t             function;
+    uint16_t            address;
+    uint16_t            nb;
+    /* 0 polls as often as the bus allows, at most MODBUS_MASTER_MAX_MS */
+    uint32_t            period_ms;
+    /* Result table, uint16_t registers or a uint32_t bitmap laid out like
+       the mapping ones, written from dest_index on */
+    void                *dest;
+    uint16_t            dest_index;
+    /* Kept by the master */
+    uint32_t            due_ticks;
+    /* Entry whose request carries this one, next entry of that request or
+       -1, and on the lead the range actually read */
+    int16_t             lead;
+    int16_t             link;
+    uint16_t            req_address;
+    uint16_t            req_nb;
+    uint16_t            done;
+    uint16_t            errors;
+    uint8_t             status;
+    uint8_t             exception;
+} mb_poll_t;
+
+/* RTU master on one serial port. The embedded mb_t holds the line: serial,
+   response assembly in rx, requests built in rsp_buffer, bus counters */
+typedef struct _mb_master_t {
+    mb_t                mb;
+    mb_poll_t           *polls;
+    uint16_t            nb_polls;
+    /* Entry on the wire and entry whose request is built, -1 if none */
+    int16_t             current;
+    int16_t             next;
+    /* Entry sent last, the round robin of due entries resumes after it */
+    int16_t             last;
+    uint8_t             req_length;
+    /* Response bytes expected for current, exception aside */
+    uint16_t            rsp_expected;
+    volatile bool       listening;
+    uint32_t            deadline_ticks;
+    uint16_t            timeouts;
+    /* Per slave response timeout in ms, 0 for MODBUS_MASTER_TIMEOUT_MS */
+    uint16_t            timeout_ms[MODBUS_NB_SLAVE_IDS];
+} mb_master_t;
+
+/**
+ * Start polling, every entry is due at once
+ * @param master context
+ * @param polls poll table, owned by the application
+ * @param nb_polls entries
+ * @param port serial line
+ * @param baud line speed
+ * @return 0, -1 if an entry is not a valid read, reads past address 65535
+ *         or has a period too long
+ */
+int mb_master_init(mb_master_t *master, mb_poll_t *polls, uint16_t nb_polls,
+                   const serial_t *port, int baud);
+
+/**
+ * Coalesce the entries of the same slave, function and period into as few
+ * requests as MODBUS_MAX_READ_REGISTERS or MODBUS_MAX_READ_BITS allow. Ranges
+ * closer than gap are read along with the addresses between them, each entry
+ * still gets its own results, status and counts. An exception or an error
+ * fails every entry of the request.
+ * @param master context, after mb_master_init()
+ * @param gap unused addresses (registers or bits) read to join two ranges,
+ *        0 joins adjacent and overlapping ones, -1 sends every entry alone
+ * @return number of requests of a cycle, -1 while a response is awaited
+ */
+int mb_master_plan(mb_master_t *master, int gap);
+
+/**
+ * Response timeout of one slave
+ * @param master context
+ * @param slave slave ID
+ * @param timeout_ms ms after the end of the request, 0 for the default, at
+ *        most MODBUS_MASTER_MAX_MS
+ * @return 0, -1 if the slave ID or the timeout is invalid
+ */
+int mb_master_set_timeout(mb_master_t *master, uint8_t slave, uint16_t timeout_ms);
+
+/**
+ * Master exchange loop, never waits for the bus
+ * @param master context
+ * @return length of a response just taken, 0 if nothing completed,
+ *         -MODBUS_POLL_* if an exchange failed
+ */
+int mb_master_loop(mb_master_t *master);
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* MODBUS_MASTER_H */
@@ -1,112 +1,13 @@
 #include <string.h>
-#include "delay.h"
 #include "modbus-rtu.h"
-#include "peripheral/uart/plib_uart1.h"
-#include "peripheral/uart/plib_uart2.h"
-
-
-enum { _STEP_FUNCTION = 0x01, _STEP_META, _STEP_DATA };
-
-/* Private variables */
-static uint8_t          slaveid = -1;
-const serial_t*         serial;
-
-/* MODBUS MAPPING REGISTERS */
-int             nb_bits;
-int             start_bits;
-int             nb_input_bits;
-int             start_input_bits;
-int             nb_input_registers;
-int             start_input_registers;
-int             nb_registers;
-int             start_registers;
-uint8_t         tab_bits[MODBUS_NB_TAB_BIT];
-uint8_t         tab_input_bits[MODBUS_NB_TAB_INPUT_BIT];
-uint16_t        tab_input_registers[MODBUS_NB_TAB_INPUT_REGISTER];
-uint16_t        tab_registers[MODBUS_NB_TAB_REGISTER];
-    
-static UART_SERIAL_SETUP setup;
-static void uart1_begin(uint32_t baud)
-{   
-    setup.baudRate  = baud;
-    setup.parity    = UART_PARITY_NONE;
-    setup.dataWidth = UART_DATA_8_BIT;
-    setup.stopBits  = UART_STOP_1_BIT;
-    
-    UART1_SerialSetup(&setup, UART1_FrequencyGet());
-}
-
-static size_t uart1_available(void)
-{
-    return UART1_ReadCountGet();
-}
-
-static uint8_t uart1_read(void)
-{
-    uint8_t c;
-   
-    UART1_Read(&c, 1);
-    return c;
-}
-
-static void uart1_write(uint8_t* buf, const size_t size)
-{
-    UART1_Write(buf, size);
-}
+#include "modbus-crc.h"
+#include "modbus-hal.h"
+#include "modbus-stats.h"
 
-const serial_t uart1 = {
-    .name       = "UART1",
-    .begin      = uart1_begin,
-    .available  = uart1_available,
-    .read       = uart1_read,
-    .write      = uart1_write,
-};
 
+enum { _STEP_IDLE = 0x00, _STEP_FUNCTION, _STEP_META, _STEP_DATA, _STEP_SKIP };
 
-static uint16_t crc16(uint8_t *req, uint8_t req_length)
-{
-    uint8_t j;
-    uint16_t crc;
 
-    crc = 0xFFFF;
-    while (req_length--) {
-        crc = crc ^ *req++;
-        for (j = 0; j < 8; j++) {
-            if (crc & 0x0001)
-                crc = (crc >> 1) ^ 0xA001;
-            else
-                crc = crc >> 1;
-        }
-    }
-
-    return (crc << 8 | crc >> 8);
-}
-
-/**
- * Check the CRC request message and calculate CRC
- * @param msg request message
- * @param msg_length request length
- * @return message length, -1 if any error
- */
-static int check_integrity(uint8_t *msg, uint8_t msg_length)
-{
-    uint16_t crc_calculated;
-    uint16_t crc_received;
-
-    if (msg_length < 2)
-        return -1;
-
-    crc_calculated = crc16(msg, msg_length - 2);
-    crc_received = (msg[msg_length - 2] << 8) | msg[msg_length - 1];
-
-    /* Check CRC of modbus message */
-    if (crc_calculated == crc_received) {
-        return msg_length;
-    } 
-    else {
-        return -1;
-    }
-}
 
 /**
  * Build a response basis include slave, function to rsp message
@@ -123,19 +24,57 @@ static int build_response_basis(uint8_t slave, uint8_t function, uint8_t *rsp)
     return MODBUS_RTU_PRESET_RSP_LENGTH;
 }
 
+/* Mapping answering for slave, NULL if this node does not serve it */
+static inline mb_mapping_t *mb_unit_mapping(const mb_t *mb, uint8_t slave)
+{
+    uint8_t unit = slave < MODBUS_NB_SLAVE_IDS ? mb->unit_index[slave] : 0;
+
+    return unit != 0 ? mb->units[unit - 1] : NULL;
+}
+
+/* Frame for one of our units or the broadcast */
+static inline bool mb_is_addressed(const mb_t *mb, uint8_t slave)
+{
+    return slave == MODBUS_BROADCAST_ADDRESS || mb_unit_mapping(mb, slave) != NULL;
+}
+
+/**
+ * Hand a written range to the application before the response is sent
+ * @param mb context
+ * @param table MODBUS_TABLE_BITS or MODBUS_TABLE_REGISTERS
+ * @param index first mapping index written
+ * @param nb number of bits or registers written
+ */
+static void notify_write(mb_t *mb, int table, int index, int nb)
+{
+    if (mb->write_handler != NULL) {
+        mb->write_handler(mb, table, index, nb);
+    }
+}
+
 /**
  * Send message to master includes CRC
+ * @param mb context
  * @param msg buffer no CRC
  * @param msg_length buffer length
  */
-static void send_msg(uint8_t *msg, uint8_t msg_length)
+static void send_msg(mb_t *mb, uint8_t *msg, uint8_t msg_length)
 {
     uint16_t crc = crc16(msg, msg_length);
 
     msg[msg_length++] = crc >> 8;
     msg[msg_length++] = crc & 0x00FF;
 
-    serial->write(msg, msg_length);
+    if (msg[MODBUS_RTU_HEADER_LENGTH] & 0x80) {
+        mb->counters.bus_exception++;
+    }
+
+#if MODBUS_STATS
+    mb->stats.stamps[MODBUS_STATS_REPLY_BUILT] = mb_hal_ticks();
+    mb->stats.function = msg[MODBUS_RTU_HEADER_LENGTH] & 0x7F;
+#endif
+
+    mb->serial->write(msg, msg_length);
 }
 
 /**
@@ -159,17 +98,6 @@ static uint8_t build_response_exception(uint8_t slave, uint8_t function,
     return rsp_length;
 }
 
-/**
- * Flush all buffer receive
- */
-static void flush(void)
-{
-    uint8_t i = 0;   
-    while (serial->available() && i++ < MODBUS_MAX_ADU_LENGTH) {
-        serial->read();
-    }
-}
-
 /*
  *  ---------- Request     Indication ----------
  *  | Client | ---------------------->| Server |
@@ -181,7 +109,8 @@ static uint8_t compute_meta_length_after_function(int function)
 {
     int length;
 
-    if (function <= MODBUS_FC_WRITE_SINGLE_REGISTER) {
+    if (function <= MODBUS_FC_WRITE_SINGLE_REGISTER ||
+        function == MODBUS_FC_DIAGNOSTICS) {
         length = 4;
     } 
     else if (function == MODBUS_FC_WRITE_MULTIPLE_COILS ||
@@ -226,70 +155,195 @@ compute_data_length_after_meta(uint8_t *msg)
 }
 
 /**
- * MODBUS listen message from master
- * @param req buffer
- * @return buffer size
+ * Compute the character time and the T1.5 (inter-character) and T3.5
+ * (inter-frame) silent intervals in HAL ticks. A character is 11 bits on the
+ * line, above 19200 baud the spec fixes the silences to 750 us and 1750 us.
+ * @param mb context
+ * @param baud line speed
+ */
+void mb_set_rx_timing(mb_t *mb, uint32_t baud)
+{
+    mb->rx.char_ticks = (uint32_t)(((uint64_t)MODBUS_HAL_TICKS_FREQUENCY * 11U) / baud);
+    if (baud > MODBUS_RTU_FIXED_TIMING_BAUD) {
+        mb->rx.t15_ticks = MODBUS_RTU_T15_FIXED_US * (MODBUS_HAL_TICKS_FREQUENCY / 1000000U);
+        mb->rx.t35_ticks = MODBUS_RTU_T35_FIXED_US * (MODBUS_HAL_TICKS_FREQUENCY / 1000000U);
+    }
+    else {
+        /* 1.5 and 3.5 characters of 11 bits, as 33 and 77 half bits */
+        mb->rx.t15_ticks = (uint32_t)(((uint64_t)MODBUS_HAL_TICKS_FREQUENCY * 33U) / (2U * baud));
+        mb->rx.t35_ticks = (uint32_t)(((uint64_t)MODBUS_HAL_TICKS_FREQUENCY * 77U) / (2U * baud));
+    }
+}
+
+/**
+ * Feed one received byte to the frame assembler. Runs in the RX interrupt
+ * when the backend provides set_rx_handler, otherwise from mb_loop().
+ * @param mb context
+ * @param c received byte
  */
-static int mb_recv(uint8_t *req)
+void mb_rx_feed(mb_t *mb, uint8_t c)
 {
-    uint8_t i;
-    uint8_t length_to_read;
-    uint8_t msg_length;
-    uint8_t step;
+    uint32_t now = mb_hal_ticks();
+    /* Between the ends of two bytes, the second one's character included */
+    uint32_t silence = now - mb->rx.last_ticks;
+
+    mb->rx.last_ticks = now;
+    if (mb->rx.ready) {
+        /* Previous frame not consumed yet, the master must wait for our reply */
+        return;
+    }
+
+    if (silence >= mb->rx.t35_ticks + mb->rx.char_ticks) {
+        /* T3.5 elapsed, this byte opens a new frame whatever came before */
+        mb->rx.step = _STEP_IDLE;
+    }
+    else if (mb->rx.step == _STEP_IDLE) {
+        /* Trailing bytes of a frame we parsed too short, wait for T3.5 */
+        mb->rx.step = _STEP_SKIP;
+    }
+    else if (silence > mb->rx.t15_ticks + mb->rx.char_ticks) {
+        /* T1.5 violated inside the frame, it must be discarded */
+        mb->rx.broken = true;
+    }
+
+    if (mb->rx.step == _STEP_SKIP) {
+        return;
+    }
 
     /* We need to analyse the message step by step.  At the first step, we want
      * to reach the function code because all packets contain this
      * information. */
-    step = _STEP_FUNCTION;
-    length_to_read = MODBUS_RTU_HEADER_LENGTH + 1;
-
-    msg_length = 0;
-    while (length_to_read != 0) {
-        if (!serial->available()) {
-            i = 0;
-            while (!serial->available()) {
-                if (++i == MODBUS_RESPONSE_BYTE_TIMEOUT) {
-                    /* Too late, bye bye */
-                    return -1 - MODBUS_INFORMATIVE_RX_TIMEOUT;
-                }
-                delay(1);
-            }
-        }
-        
-        req[msg_length] = serial->read();
-        /* Moves the pointer to receive other data */
-        msg_length++;
-        /* Computes remaining bytes */
-        length_to_read--;
-
-        if (length_to_read == 0) {
-            if (req[MODBUS_RTU_HEADER_LENGTH - 1] != slaveid 
-                    && req[MODBUS_RTU_HEADER_LENGTH - 1] != MODBUS_BROADCAST_ADDRESS) {
-                flush();
-                return -1 - MODBUS_INFORMATIVE_NOT_FOR_US;
-            }
+    if (mb->rx.step == _STEP_IDLE) {
+        mb->rx.step = _STEP_FUNCTION;
+        mb->rx.broken = false;
+#if MODBUS_STATS
+        mb->rx.first_ticks = now;
+#endif
+        mb->rx.crc = MODBUS_CRC_INIT;
+        mb->rx.length = 0;
+        mb->rx.length_to_read = MODBUS_RTU_HEADER_LENGTH + 1;
+    }
 
-            switch (step) {
-            case _STEP_FUNCTION:
-                /* Function code position */
-                length_to_read = compute_meta_length_after_function(req[MODBUS_RTU_HEADER_LENGTH]);
-                if (length_to_read != 0) {
-                    step = _STEP_META;
-                    break;
-                } /* else switches straight to the next step */
-            case _STEP_META:
-                length_to_read = compute_data_length_after_meta(req);
-                if ((msg_length + length_to_read) > MODBUS_MAX_ADU_LENGTH) {
-                    return -1;
-                }
-                step = _STEP_DATA;
-                break;
-            default:
-                break;
-            }
+    mb->rx.adu[mb->rx.length++] = c;
+    mb->rx.crc = crc16_update(mb->rx.crc, c);
+    if (--mb->rx.length_to_read != 0) {
+        return;
+    }
+
+    switch (mb->rx.step) {
+    case _STEP_FUNCTION:
+        /* Function code position */
+        mb->rx.length_to_read = compute_meta_length_after_function(mb->rx.adu[MODBUS_RTU_HEADER_LENGTH]);
+        if (mb->rx.length_to_read != 0) {
+            mb->rx.step = _STEP_META;
+            break;
+        } /* else switches straight to the next step */
+    case _STEP_META:
+        mb->rx.length_to_read = compute_data_length_after_meta(mb->rx.adu);
+        if ((mb->rx.length + mb->rx.length_to_read) > MODBUS_RTU_MAX_ADU_LENGTH) {
+            mb->rx.step = _STEP_SKIP;
+            break;
+        }
+        mb->rx.step = _STEP_DATA;
+        break;
+    default:
+        /* Whole frame received, frames for other slaves keep us in sync and
+         * are dropped here */
+        mb->rx.step = _STEP_IDLE;
+        if (mb->rx.broken || mb->rx.crc != 0) {
+            mb->counters.bus_comm_error++;
+        }
+        else {
+            mb->counters.bus_message++;
         }
+        if (!mb->rx.broken
+                && mb_is_addressed(mb, mb->rx.adu[MODBUS_RTU_HEADER_LENGTH - 1])) {
+            mb->rx.frame = mb->rx.adu;
+#if MODBUS_STATS
+            mb->rx.end_ticks = now;
+#endif
+            __sync_synchronize();
+            mb->rx.ready = true;
+        }
+        break;
+    }
+}
+
+/**
+ * Account line errors reported by the backend, from its error interrupt. A
+ * frame being received is discarded and counted when it ends.
+ * @param mb context
+ * @param errors MODBUS_SERIAL_ERROR_* flags
+ */
+void mb_rx_error(mb_t *mb, uint32_t errors)
+{
+    if (errors & MODBUS_SERIAL_ERROR_OVERRUN) {
+        mb->counters.bus_char_overrun++;
+    }
+    if (mb->rx.step != _STEP_IDLE && mb->rx.step != _STEP_SKIP) {
+        mb->rx.broken = true;
+    }
+    else if (errors & (MODBUS_SERIAL_ERROR_FRAMING | MODBUS_SERIAL_ERROR_PARITY)) {
+        mb->counters.bus_comm_error++;
+    }
+}
+
+/**
+ * Communication counters, as returned by FC 0x08
+ * @param mb context
+ * @return counters since start or the last clear
+ */
+const mb_counters_t *mb_get_counters(const mb_t *mb)
+{
+    return &mb->counters;
+}
+
+/**
+ * Take a whole frame delimited by the backend. The buffer is parsed in place
+ * and stays with the core until a later call returns true.
+ * @param mb context
+ * @param adu frame buffer, slave address first
+ * @param length frame length including CRC
+ * @return true if the frame was taken, false if the backend can reuse adu
+ */
+bool mb_rx_frame(mb_t *mb, uint8_t *adu, uint16_t length)
+{
+    uint16_t expected = MODBUS_RTU_HEADER_LENGTH + 1 + MODBUS_RTU_CHECKSUM_LENGTH;
+    uint16_t crc;
+
+    /* The frame must be as long as its function code and byte count say,
+       the same lengths mb_rx_feed() reads */
+    if (length >= expected) {
+        expected += compute_meta_length_after_function(adu[MODBUS_RTU_HEADER_LENGTH]);
     }
-    return check_integrity(req, msg_length);
+    if (length >= expected) {
+        expected += compute_data_length_after_meta(adu) - MODBUS_RTU_CHECKSUM_LENGTH;
+    }
+    if (length != expected || length > MODBUS_RTU_MAX_ADU_LENGTH
+            || (crc = crc16(adu, length)) != 0) {
+        mb->counters.bus_comm_error++;
+        return false;
+    }
+    mb->counters.bus_message++;
+
+    if (mb->rx.ready) {
+        /* Previous frame not consumed yet, the master must wait for our reply */
+        return false;
+    }
+    if (!mb_is_addressed(mb, adu[MODBUS_RTU_HEADER_LENGTH - 1])) {
+        return false;
+    }
+
+    mb->rx.frame = adu;
+    mb->rx.length = length;
+#if MODBUS_STATS
+    /* Bytes were not timed one by one, the frame is seen when delimited */
+    mb->rx.first_ticks = mb->rx.end_ticks = mb_hal_ticks();
+#endif
+    mb->rx.crc = crc;
+    __sync_synchronize();
+    mb->rx.ready = true;
+    return true;
 }
 
 /* Computes the length of the expected response including checksum */
@@ -330,69 +384,51 @@ static unsigned int compute_response_length_from_request(uint8_t *req)
 
 /**
  * Build response io status
- * @param tab_io_status table bits
+ * @param tab_io_status packed table bits
  * @param address start address
  * @param nb amount
  * @param rsp response buffer
  * @param offset
  * @return offset
  */
-static int response_io_status(uint8_t *tab_io_status, 
+static int response_io_status(const uint32_t *tab_io_status,
                               int address, int nb, uint8_t *rsp, int offset)
 {
-    int shift = 0;
-    int one_byte = 0;
-    int i;
-
-    for (i = address; i < address + nb; i++) {
-        one_byte |= tab_io_status[i] << shift;
-        if (shift == 7) {
-            /* Byte is full */
-            rsp[offset++] = one_byte;
-            one_byte = shift = 0;
-        } 
-        else {
-            shift++;
-        }
-    }
-
-    if (shift != 0)
-        rsp[offset++] = one_byte;
-
-    return offset;
+    return offset + modbus_bitmap_get_bytes(tab_io_status, address, nb, rsp + offset);
 }
 
 
 /**
- * Reply to master
+ * Run a request against the tables of one unit and build the response
+ * @param mb context
+ * @param mapping tables of the unit
  * @param req request message
  * @param req_length size
+ * @return response length without CRC
  */
-static void mb_reply(uint8_t *req, uint8_t req_length)
+static uint8_t mb_process(mb_t *mb, mb_mapping_t *mapping, uint8_t *req, uint16_t req_length)
 {
     int offset;
     uint8_t slave;
     uint8_t function;
     uint16_t address;
-    uint8_t rsp[MODBUS_MAX_ADU_LENGTH];
+    uint8_t *rsp = mb->rsp_adu;
     uint8_t rsp_length = 0;
     
     offset              = MODBUS_RTU_HEADER_LENGTH;
     slave               = req[offset - 1];
     function            = req[offset];
     address             = (req[offset + 1] << 8) + req[offset + 2];
-      
-    if (slave != slaveid && slave != MODBUS_BROADCAST_ADDRESS) {
-        return;
-    }
+    /* Seen by the write handler */
+    mb->unit            = mapping;
 
     switch (function) {
         case MODBUS_FC_READ_COILS:
         case MODBUS_FC_READ_DISCRETE_INPUTS: {
             unsigned int is_input = (function == MODBUS_FC_READ_DISCRETE_INPUTS);
-            int start_bit = is_input ? start_input_bits : start_bits;
-            int nb_bit = is_input ? nb_input_bits : nb_bits;
-            uint8_t *tab = is_input ? tab_input_bits : tab_bits;
+            int start_bit = is_input ? mapping->start_input_bits : mapping->start_bits;
+            int nb_bit = is_input ? mapping->nb_input_bits : mapping->nb_bits;
+            const uint32_t *tab = is_input ? mapping->tab_input_bits : mapping->tab_bits;
             int nb = (req[offset + 3] << 8) + req[offset + 4];
             int mapping_address = address - start_bit;
 
@@ -414,9 +450,9 @@ static void mb_reply(uint8_t *req, uint8_t req_length)
         case MODBUS_FC_READ_HOLDING_REGISTERS:
         case MODBUS_FC_READ_INPUT_REGISTERS: {
             unsigned int is_input = (function == MODBUS_FC_READ_INPUT_REGISTERS);
-            int start_reg = is_input ? start_input_registers : start_registers;
-            int nb_reg = is_input ? nb_input_registers : nb_registers;
-            uint16_t *tab = is_input ? tab_input_registers : tab_registers;
+            int start_reg = is_input ? mapping->start_input_registers : mapping->start_registers;
+            int nb_reg = is_input ? mapping->nb_input_registers : mapping->nb_registers;
+            uint16_t *tab = is_input ? mapping->tab_input_registers : mapping->tab_registers;
             int nb = (req[offset + 3] << 8) + req[offset + 4];
             int mapping_address = address - start_reg;
 
@@ -438,8 +474,8 @@ static void mb_reply(uint8_t *req, uint8_t req_length)
             }
         } break;
         case MODBUS_FC_WRITE_SINGLE_COIL: {
-            int mapping_address = address - start_bits;
-            if (mapping_address < 0 || mapping_address >= nb_bits) {
+            int mapping_address = address - mapping->start_bits;
+            if (mapping_address < 0 || mapping_address >= mapping->nb_bits) {
                 rsp_length = 
                         build_response_exception(slave, function, MODBUS_EXCEPTION_ILLEGAL_DATA_ADDRESS, rsp);
                 break;
@@ -461,7 +497,8 @@ static void mb_reply(uint8_t *req, uint8_t req_length)
             int data = (req[offset + 3] << 8) + req[offset + 4];
             if (data == 0xFF00 || data == 0x0) {
                 /* Apply the change to mapping */
-                tab_bits[mapping_address] = data ? 1 : 0;
+                MODBUS_SET_BIT(mapping->tab_bits, mapping_address, data);
+                notify_write(mb, MODBUS_TABLE_BITS, mapping_address, 1);
                 /* Prepare response */
                 memcpy(rsp, req, rsp_length);
             } 
@@ -471,9 +508,9 @@ static void mb_reply(uint8_t *req, uint8_t req_length)
             }
         } break;
         case MODBUS_FC_WRITE_SINGLE_REGISTER: {
-            int mapping_address = address - start_registers;
+            int mapping_address = address - mapping->start_registers;
 
-            if (mapping_address < 0 || mapping_address >= nb_registers) {
+            if (mapping_address < 0 || mapping_address >= mapping->nb_registers) {
                 rsp_length = 
                         build_response_exception(slave, function, MODBUS_EXCEPTION_ILLEGAL_DATA_ADDRESS, rsp);
                 break;
@@ -487,7 +524,8 @@ static void mb_reply(uint8_t *req, uint8_t req_length)
                 break;
             }
             int data = (req[offset + 3] << 8) + req[offset + 4];
-            tab_registers[mapping_address] = data;
+            mapping->tab_registers[mapping_address] = data;
+            notify_write(mb, MODBUS_TABLE_REGISTERS, mapping_address, 1);
 
             rsp_length -= MODBUS_RTU_CHECKSUM_LENGTH;
             memcpy(rsp, req, rsp_length);
@@ -495,7 +533,7 @@ static void mb_reply(uint8_t *req, uint8_t req_length)
         case MODBUS_FC_WRITE_MULTIPLE_COILS: {
             int nb = (req[offset + 3] << 8) + req[offset + 4];
             int nb_bit = req[offset + 5];
-            int mapping_address = address - start_bits;
+            int mapping_address = address - mapping->start_bits;
 
             if (nb < 1 || MODBUS_MAX_WRITE_BITS < nb || nb_bit * 8 < nb) {
                 /* May be the indication has been truncated on reading because of
@@ -504,13 +542,14 @@ static void mb_reply(uint8_t *req, uint8_t req_length)
                 rsp_length = 
                         build_response_exception(slave, function, MODBUS_EXCEPTION_ILLEGAL_DATA_VALUE, rsp);
             } 
-            else if (mapping_address < 0 || (mapping_address + nb) > nb_bits) {
+            else if (mapping_address < 0 || (mapping_address + nb) > mapping->nb_bits) {
                 rsp_length = 
                         build_response_exception(slave, function, MODBUS_EXCEPTION_ILLEGAL_DATA_ADDRESS, rsp);
             } 
             else {
                 /* 6 = byte count */
-                modbus_set_bits_from_bytes(tab_bits, mapping_address, nb, &req[offset + 6]);
+                modbus_bitmap_set_bytes(mapping->tab_bits, mapping_address, nb, &req[offset + 6]);
+                notify_write(mb, MODBUS_TABLE_BITS, mapping_address, nb);
 
                 rsp_length = build_response_basis(slave, function, rsp);
                 /* 4 to copy the bit address (2) and the quantity of bits */
@@ -521,13 +560,13 @@ static void mb_reply(uint8_t *req, uint8_t req_length)
         case MODBUS_FC_WRITE_MULTIPLE_REGISTERS: {
             int nb = (req[offset + 3] << 8) + req[offset + 4];
             int nb_bytes = req[offset + 5];
-            int mapping_address = address - start_registers;
+            int mapping_address = address - mapping->start_registers;
 
             if (nb < 1 || MODBUS_MAX_WRITE_REGISTERS < nb || nb_bytes != nb * 2) {
                 rsp_length = 
                         build_response_exception(slave, function, MODBUS_EXCEPTION_ILLEGAL_DATA_VALUE, rsp);
             } 
-            else if (mapping_address < 0 || (mapping_address + nb) > nb_registers) {
+            else if (mapping_address < 0 || (mapping_address + nb) > mapping->nb_registers) {
                 rsp_length = 
                         build_response_exception(slave, function, MODBUS_EXCEPTION_ILLEGAL_DATA_ADDRESS, rsp);
             } 
@@ -535,70 +574,353 @@ static void mb_reply(uint8_t *req, uint8_t req_length)
                 int i, j;
                 for (i = mapping_address, j = 6; i < mapping_address + nb; i++, j += 2) {
                     /* 6 and 7 = first value */
-                    tab_registers[i] = (req[offset + j] << 8) + req[offset + j + 1];
+                    mapping->tab_registers[i] = (req[offset + j] << 8) + req[offset + j + 1];
                 }
+                notify_write(mb, MODBUS_TABLE_REGISTERS, mapping_address, nb);
 
                 rsp_length = build_response_basis(slave, function, rsp);
                 /* 4 to copy the address (2) and the no. of registers */
                 memcpy(rsp + rsp_length, req + rsp_length, 4);
                 rsp_length += 4;
             }
-        } break;                  
+        } break;
+        case MODBUS_FC_DIAGNOSTICS: {
+            int data = (req[offset + 3] << 8) + req[offset + 4];
+            int value = -1;
+
+            /* Counters and clears only take 0x0000 as data */
+            if (address != MODBUS_DIAG_RETURN_QUERY_DATA && data != 0) {
+                rsp_length =
+                        build_response_exception(slave, function, MODBUS_EXCEPTION_ILLEGAL_DATA_VALUE, rsp);
+                break;
+            }
+
+            switch (address) {
+            case MODBUS_DIAG_RETURN_QUERY_DATA:
+                break;
+            case MODBUS_DIAG_CLEAR_COUNTERS:
+                memset(&mb->counters, 0, sizeof(mb->counters));
+#if MODBUS_STATS
+                mb_stats_clear(mb);
+#endif
+                break;
+            case MODBUS_DIAG_CLEAR_OVERRUN_COUNTER:
+                mb->counters.bus_char_overrun = 0;
+                break;
+            case MODBUS_DIAG_RETURN_DIAGNOSTIC_REGISTER:
+            case MODBUS_DIAG_SLAVE_NAK_COUNT:
+            case MODBUS_DIAG_SLAVE_BUSY_COUNT:
+                /* Never NAK nor busy */
+                value = 0;
+                break;
+            case MODBUS_DIAG_BUS_MESSAGE_COUNT:
+                value = mb->counters.bus_message;
+                break;
+            case MODBUS_DIAG_BUS_COMM_ERROR_COUNT:
+                value = mb->counters.bus_comm_error;
+                break;
+            case MODBUS_DIAG_BUS_EXCEPTION_ERROR_COUNT:
+                value = mb->counters.bus_exception;
+                break;
+            case MODBUS_DIAG_SLAVE_MESSAGE_COUNT:
+                value = mb->counters.slave_message;
+                break;
+            case MODBUS_DIAG_SLAVE_NO_RESPONSE_COUNT:
+                value = mb->counters.slave_no_response;
+                break;
+            case MODBUS_DIAG_BUS_CHAR_OVERRUN_COUNT:
+                value = mb->counters.bus_char_overrun;
+                break;
+            default:
+                rsp_length =
+                        build_response_exception(slave, function, MODBUS_EXCEPTION_ILLEGAL_FUNCTION, rsp);
+                break;
+            }
+            if (rsp_length != 0) {
+                break;
+            }
+
+            /* Echo of the sub-function, then the query data or the value */
+            rsp_length = req_length - MODBUS_RTU_CHECKSUM_LENGTH;
+            memcpy(rsp, req, rsp_length);
+            if (value >= 0) {
+                rsp[offset + 3] = value >> 8;
+                rsp[offset + 4] = value & 0xFF;
+            }
+        } break;
+        case MODBUS_FC_MASK_WRITE_REGISTER: {
+            int mapping_address = address - mapping->start_registers;
+
+            if (mapping_address < 0 || mapping_address >= mapping->nb_registers) {
+                rsp_length =
+                        build_response_exception(slave, function, MODBUS_EXCEPTION_ILLEGAL_DATA_ADDRESS, rsp);
+            }
+            else {
+                uint16_t and_mask = (req[offset + 3] << 8) + req[offset + 4];
+                uint16_t or_mask = (req[offset + 5] << 8) + req[offset + 6];
+                uint16_t data = mapping->tab_registers[mapping_address];
+
+                mapping->tab_registers[mapping_address] = (data & and_mask) | (or_mask & ~and_mask);
+                notify_write(mb, MODBUS_TABLE_REGISTERS, mapping_address, 1);
+
+                rsp_length = req_length - MODBUS_RTU_CHECKSUM_LENGTH;
+                memcpy(rsp, req, rsp_length);
+            }
+        } break;
+        case MODBUS_FC_WRITE_AND_READ_REGISTERS: {
+            int nb = (req[offset + 3] << 8) + req[offset + 4];
+            uint16_t address_write = (req[offset + 5] << 8) + req[offset + 6];
+            int nb_write = (req[offset + 7] << 8) + req[offset + 8];
+            int nb_write_bytes = req[offset + 9];
+            int mapping_address = address - mapping->start_registers;
+            int mapping_address_write = address_write - mapping->start_registers;
+
+            if (nb_write < 1 || MODBUS_MAX_WR_WRITE_REGISTERS < nb_write ||
+                nb < 1 || MODBUS_MAX_WR_READ_REGISTERS < nb ||
+                nb_write_bytes != nb_write * 2) {
+                rsp_length =
+                        build_response_exception(slave, function, MODBUS_EXCEPTION_ILLEGAL_DATA_VALUE, rsp);
+            }
+            else if (mapping_address < 0 || (mapping_address + nb) > mapping->nb_registers ||
+                     mapping_address_write < 0 ||
+                     (mapping_address_write + nb_write) > mapping->nb_registers) {
+                rsp_length =
+                        build_response_exception(slave, function, MODBUS_EXCEPTION_ILLEGAL_DATA_ADDRESS, rsp);
+            }
+            else {
+                int i, j;
+                rsp_length = build_response_basis(slave, function, rsp);
+                rsp[rsp_length++] = nb << 1;
+
+                /* Write first, 10 and 11 are the offset of the first values
+                   to write, so an overlapping read returns the new values */
+                for (i = mapping_address_write, j = 10; i < mapping_address_write + nb_write; i++, j += 2) {
+                    mapping->tab_registers[i] = (req[offset + j] << 8) + req[offset + j + 1];
+                }
+                notify_write(mb, MODBUS_TABLE_REGISTERS, mapping_address_write, nb_write);
+
+                /* and read the data for the response */
+                for (i = mapping_address; i < mapping_address + nb; i++) {
+                    rsp[rsp_length++] = mapping->tab_registers[i] >> 8;
+                    rsp[rsp_length++] = mapping->tab_registers[i] & 0xFF;
+                }
+            }
+        } break;
         default:
             rsp_length = 
                         build_response_exception(slave, function, MODBUS_EXCEPTION_ILLEGAL_FUNCTION, rsp);
             break;
     }
     
-    send_msg(rsp, rsp_length);
+
+    return rsp_length;
 }
 
 
-void mb_set_slave(uint8_t slave)
+/**
+ * Reply to master
+ * @param mb context
+ * @param req request message
+ * @param req_length size
+ */
+static void mb_reply(mb_t *mb, uint8_t *req, uint16_t req_length)
 {
-    if (slave > 0 && slave < 247) {
-        slaveid = slave;
+    uint8_t slave = req[MODBUS_RTU_HEADER_LENGTH - 1];
+    uint8_t function = req[MODBUS_RTU_HEADER_LENGTH];
+    mb_mapping_t *mapping = mb_unit_mapping(mb, slave);
+    uint8_t rsp_length;
+    uint8_t unit;
+
+    if (mapping == NULL && slave != MODBUS_BROADCAST_ADDRESS) {
+        return;
+    }
+    mb->counters.slave_message++;
+
+    /* Only writes make sense on a broadcast, nobody would hear the answer
+       to a read or an exception */
+    if (slave == MODBUS_BROADCAST_ADDRESS
+            && function != MODBUS_FC_WRITE_SINGLE_COIL
+            && function != MODBUS_FC_WRITE_SINGLE_REGISTER
+            && function != MODBUS_FC_WRITE_MULTIPLE_COILS
+            && function != MODBUS_FC_WRITE_MULTIPLE_REGISTERS) {
+        mb->counters.slave_no_response++;
+        return;
     }
+
+    /* Every slave got the broadcast, all answering at once would collide,
+       every unit of this node with a slave ID applies it, the first one has
+       none until mb_set_slave(). Tables shared by several IDs are written
+       once */
+    if (slave == MODBUS_BROADCAST_ADDRESS) {
+        uint8_t first = mb->slave < MODBUS_NB_SLAVE_IDS ? 0 : 1;
+        uint8_t done;
+
+        for (unit = first; unit < mb->nb_units; unit++) {
+            for (done = first; done < unit && mb->units[done] != mb->units[unit]; done++) {
+            }
+            if (done == unit) {
+                mb_process(mb, mb->units[unit], req, req_length);
+            }
+        }
+        mb->counters.slave_no_response++;
+        return;
+    }
+
+    rsp_length = mb_process(mb, mapping, req, req_length);
+    send_msg(mb, mb->rsp_adu, rsp_length);
 }
 
-void mb_init(int baud)
+
+void mb_mapping_init(mb_mapping_t *mapping)
 {
-    /* Initialize registers mapping */
-    nb_bits                 = MODBUS_NB_TAB_BIT; 
-    start_bits              = 0;    
-    nb_input_bits           = MODBUS_NB_TAB_INPUT_BIT;
-    start_input_bits        = 0;
-    nb_input_registers      = MODBUS_NB_TAB_INPUT_REGISTER;
-    start_input_registers   = 0;
-    nb_registers            = MODBUS_NB_TAB_REGISTER;
-    start_registers         = 0;
-    
+    memset(mapping, 0, sizeof(*mapping));
+    mapping->nb_bits                 = MODBUS_NB_TAB_BIT;
+    mapping->start_bits              = 0;
+    mapping->nb_input_bits           = MODBUS_NB_TAB_INPUT_BIT;
+    mapping->start_input_bits        = 0;
+    mapping->nb_input_registers      = MODBUS_NB_TAB_INPUT_REGISTER;
+    mapping->start_input_registers   = 0;
+    mapping->nb_registers            = MODBUS_NB_TAB_REGISTER;
+    mapping->start_registers         = 0;
+}
+
+void mb_set_slave(mb_t *mb, uint8_t slave)
+{
+    if (slave != MODBUS_BROADCAST_ADDRESS && slave < MODBUS_NB_SLAVE_IDS
+            && mb->unit_index[slave] == 0) {
+        if (mb->slave < MODBUS_NB_SLAVE_IDS) {
+            mb->unit_index[mb->slave] = 0;
+        }
+        mb->slave = slave;
+        mb->unit_index[slave] = 1;
+    }
+}
+
+/**
+ * Answer one more slave ID on the same port, from its own tables
+ * @param mb context
+ * @param slave slave ID, not served yet
+ * @param mapping tables of the unit, may be shared with other units
+ * @return unit number, -1 if the ID is taken or invalid or the table is full
+ */
+int mb_add_unit(mb_t *mb, uint8_t slave, mb_mapping_t *mapping)
+{
+    if (slave == MODBUS_BROADCAST_ADDRESS || slave >= MODBUS_NB_SLAVE_IDS
+            || mb->unit_index[slave] != 0 || mb->nb_units >= MODBUS_MAX_UNITS) {
+        return -1;
+    }
+    mb->units[mb->nb_units] = mapping;
+    mb->unit_index[slave] = ++mb->nb_units;
+    return mb->nb_units - 1;
+}
+
+void mb_set_write_handler(mb_t *mb, void (*handler)(mb_t *mb, int table, int index, int nb))
+{
+    mb->write_handler = handler;
+}
+
+void mb_init(mb_t *mb, mb_mapping_t *mapping, const serial_t *port, int baud)
+{
+    memset(mb, 0, sizeof(*mb));
+    mb->slave = -1;
+    mb->mapping = mapping;
+    mb->units[0] = mapping;
+    mb->nb_units = 1;
+    MODBUS_DMA_FLUSH(mb->rsp_buffer, sizeof(mb->rsp_buffer));
+    mb->rsp_adu = MODBUS_DMA_ALIAS(mb->rsp_buffer);
+
+#if MODBUS_STATS
+    /* Ports sharing a mapping would overwrite each other's blocks, only the
+       first one initialised publishes there */
+    if (mapping->stats_owner == NULL || mapping->stats_owner == mb) {
+        mapping->stats_owner = mb;
+        mb->stats.registers = &mapping->tab_input_registers[MODBUS_STATS_ADDRESS];
+    }
+    mb->stats.function = -1;
+    mb_stats_clear(mb);
+#endif
+
     /* Setup serial line */
-    serial = &uart1;
-    serial->begin(baud);
+    mb->rx.step = _STEP_IDLE;
+    mb->rx.ready = false;
+    mb_set_rx_timing(mb, baud);
+    mb->rx.last_ticks = mb_hal_ticks();
+    mb->serial = port;
+    mb->serial->begin(baud);
+    if (mb->serial->set_frame_handler != NULL) {
+        mb->serial->set_frame_handler(mb_rx_frame, mb);
+    }
+    else if (mb->serial->set_rx_handler != NULL) {
+        mb->serial->set_rx_handler(mb_rx_feed, mb);
+    }
+    if (mb->serial->set_error_handler != NULL) {
+        mb->serial->set_error_handler(mb_rx_error, mb);
+    }
 }
 
 
+#if MODBUS_STATS
+/* Records the answered exchange once its last byte left the line, or once
+   the backend took it when it cannot tell */
+static void stats_finish(mb_t *mb)
+{
+    const serial_t *serial = mb->serial;
+
+    if (mb->stats.function < 0) {
+        return;
+    }
+    if (serial->tx_complete != NULL ? serial->tx_complete()
+            : !(serial->tx_busy != NULL && serial->tx_busy())) {
+        mb->stats.stamps[MODBUS_STATS_TX_DONE] = mb_hal_ticks();
+        mb_stats_record(mb, mb->stats.function, mb->stats.stamps);
+        mb->stats.function = -1;
+    }
+}
+#endif
+
 /**
- * MODBUS exchange loop
- * @return 0 if a slave filtering, -1 undefined error, -2 exception illegal function
+ * MODBUS exchange loop, never waits for the bus
+ * @param mb context
+ * @return length of the request taken, answered or with an exception,
+ *         0 if no request was complete, -1 if it failed its CRC
  */
-int mb_loop(void)
+int mb_loop(mb_t *mb)
 {
-    int rc = 0;    
-    uint8_t req[MODBUS_MAX_ADU_LENGTH];
+    int rc = 0;
+
+#if MODBUS_STATS
+    stats_finish(mb);
+#endif
 
-    if (serial->available()) {
-        rc = mb_recv(req);
-        if (rc > 0) {
-            mb_reply(req, rc);
+    /* Backends without RX interrupt are drained here */
+    if (mb->serial->set_rx_handler == NULL && mb->serial->set_frame_handler == NULL) {
+        while (!mb->rx.ready && mb->serial->available()) {
+            mb_rx_feed(mb, mb->serial->read());
+        }
+    }
+
+    /* The response buffer is busy until the previous reply is out */
+    if (mb->rx.ready && !(mb->serial->tx_busy != NULL && mb->serial->tx_busy())) {
+        /* The CRC covers its own field so a valid frame leaves 0 */
+        if (mb->rx.crc == 0) {
+#if MODBUS_STATS
+            mb->stats.stamps[MODBUS_STATS_FIRST_BYTE] = mb->rx.first_ticks;
+            mb->stats.stamps[MODBUS_STATS_LAST_BYTE] = mb->rx.end_ticks;
+            mb->stats.stamps[MODBUS_STATS_CRC_CHECKED] = mb_hal_ticks();
+#endif
+            rc = mb->rx.length;
+            mb_reply(mb, mb->rx.frame, rc);
+#if MODBUS_STATS
+            stats_finish(mb);
+#endif
+        }
+        else {
+            rc = -1;
         }
+        /* Hand the buffer back to the receiver */
+        mb->rx.ready = false;
     }
 
-    /* Returns a positive value if successful,
-       0 if a slave filtering has occured,
-       -1 if an undefined error has occured,
-       -2 for MODBUS_EXCEPTION_ILLEGAL_FUNCTION
-       etc */
+    /* Exceptions are answered by mb_reply(), they count as a request taken */
     return rc;
 }
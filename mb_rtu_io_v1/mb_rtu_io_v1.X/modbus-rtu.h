@@ -11,6 +11,7 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include "modbus-stats.h"
 
 #define MODBUS_BROADCAST_ADDRESS                    0
 
@@ -36,12 +37,27 @@
 #define MODBUS_FC_WRITE_SINGLE_COIL                 0x05
 #define MODBUS_FC_WRITE_SINGLE_REGISTER             0x06
 #define MODBUS_FC_READ_EXCEPTION_STATUS             0x07
+#define MODBUS_FC_DIAGNOSTICS                       0x08
 #define MODBUS_FC_WRITE_MULTIPLE_COILS              0x0F
 #define MODBUS_FC_WRITE_MULTIPLE_REGISTERS          0x10
 #define MODBUS_FC_REPORT_SLAVE_ID                   0x11
 #define MODBUS_FC_MASK_WRITE_REGISTER               0x16
 #define MODBUS_FC_WRITE_AND_READ_REGISTERS          0x17
 
+/* Diagnostics sub-functions */
+#define MODBUS_DIAG_RETURN_QUERY_DATA               0x00
+#define MODBUS_DIAG_RETURN_DIAGNOSTIC_REGISTER      0x02
+#define MODBUS_DIAG_CLEAR_COUNTERS                  0x0A
+#define MODBUS_DIAG_BUS_MESSAGE_COUNT               0x0B
+#define MODBUS_DIAG_BUS_COMM_ERROR_COUNT            0x0C
+#define MODBUS_DIAG_BUS_EXCEPTION_ERROR_COUNT       0x0D
+#define MODBUS_DIAG_SLAVE_MESSAGE_COUNT             0x0E
+#define MODBUS_DIAG_SLAVE_NO_RESPONSE_COUNT         0x0F
+#define MODBUS_DIAG_SLAVE_NAK_COUNT                 0x10
+#define MODBUS_DIAG_SLAVE_BUSY_COUNT                0x11
+#define MODBUS_DIAG_BUS_CHAR_OVERRUN_COUNT          0x12
+#define MODBUS_DIAG_CLEAR_OVERRUN_COUNTER           0x14
+
 
 #define MODBUS_MAX_READ_BITS                        2000
 #define MODBUS_MAX_WRITE_BITS                       1968
@@ -54,55 +70,214 @@
 
 
 /* Size of registers mapping */
-#define MODBUS_NB_TAB_BIT                           500
-#define MODBUS_NB_TAB_INPUT_BIT                     500
+#define MODBUS_NB_TAB_BIT                           4000
+#define MODBUS_NB_TAB_INPUT_BIT                     4000
 #define MODBUS_NB_TAB_INPUT_REGISTER                500
 #define MODBUS_NB_TAB_REGISTER                      500
 
+/* Slave IDs 0 to 247, 0 is the broadcast */
+#define MODBUS_NB_SLAVE_IDS                         248
+
+/* Units one context answers for, each slave ID with its own mapping */
+#ifndef MODBUS_MAX_UNITS
+#define MODBUS_MAX_UNITS                            8
+#endif
+
 #define MSG_LENGTH_UNDEFINED                        -1
 /* MODBUS RTU */
 #define MODBUS_RTU_CHECKSUM_LENGTH                  2
 #define MODBUS_RTU_HEADER_LENGTH                    1
 #define MODBUS_RTU_PRESET_RSP_LENGTH                2
+/* Slave address, PDU and CRC, what a request length in uint8_t must hold */
+#define MODBUS_RTU_MAX_ADU_LENGTH                   256
 #define MODBUS_INFORMATIVE_NOT_FOR_US               4
 #define MODBUS_INFORMATIVE_RX_TIMEOUT               5
 
 
-/* MODBUS TIMEOUT */
-#define MODBUS_RESPONSE_BYTE_TIMEOUT                10
+/* MODBUS RTU silent intervals, fixed above 19200 baud */
+#define MODBUS_RTU_FIXED_TIMING_BAUD                19200
+#define MODBUS_RTU_T15_FIXED_US                     750
+#define MODBUS_RTU_T35_FIXED_US                     1750
 
 #ifdef	__cplusplus
 extern "C" {
 #endif
 
-/* Backend serial line */    
+/* Coils and discrete inputs are packed 32 per word, bit i of a table is bit
+   (i % 32) of word i / 32. One spare word lets readers fetch word pairs. */
+#define MODBUS_BITMAP_WORDS(nb)                     ((((nb) + 31) / 32) + 1)
+#define MODBUS_GET_BIT(tab, i)                      (((tab)[(i) >> 5] >> ((i) & 31)) & 1U)
+#define MODBUS_SET_BIT(tab, i, value)                               \
+    do {                                                            \
+        if (value)                                                  \
+            (tab)[(i) >> 5] |= (uint32_t)1 << ((i) & 31);           \
+        else                                                        \
+            (tab)[(i) >> 5] &= ~((uint32_t)1 << ((i) & 31));        \
+    } while (0)
+
+/* Buffers read or written by the DMA controller bypass the data cache */
+#ifdef __XC32
+#define MODBUS_DMA_BUFFER                           __attribute__((coherent, aligned(16)))
+#else
+#define MODBUS_DMA_BUFFER
+#endif
+
+/* A DMA buffer inside a bigger object cannot be placed in uncached memory on
+   its own: it fills whole cache lines and is only accessed through its KSEG1
+   (uncached) alias */
+#ifdef __XC32
+#define MODBUS_DMA_LINE                             16
+#define MODBUS_DMA_ALIAS(buf)                       ((uint8_t *)((uintptr_t)(buf) | 0x20000000U))
+#else
+#define MODBUS_DMA_LINE                             4
+#define MODBUS_DMA_ALIAS(buf)                       (buf)
+#endif
+#define MODBUS_DMA_SIZE(size)                       \
+    (((size) + MODBUS_DMA_LINE - 1) / MODBUS_DMA_LINE * MODBUS_DMA_LINE)
+
+/* Writes through the cached address (startup code, memset) leave dirty lines
+   whose eviction would overwrite what went through the alias since, write
+   them back and drop them before the first use of the alias. D-cache
+   Hit_Writeback_Inv on each line, then a sync */
+#ifdef __XC32
+#define MODBUS_DMA_FLUSH(buf, size)                                 \
+    do {                                                            \
+        uintptr_t _line;                                            \
+        for (_line = (uintptr_t)(buf); _line < (uintptr_t)(buf) + (size); \
+                _line += MODBUS_DMA_LINE) {                         \
+            __builtin_mips_cache(0x15, (const volatile void *)_line); \
+        }                                                           \
+        __asm__ __volatile__("sync" ::: "memory");                  \
+    } while (0)
+#else
+#define MODBUS_DMA_FLUSH(buf, size)                 ((void)0)
+#endif
+
+/* Line errors reported by serial_t backends */
+#define MODBUS_SERIAL_ERROR_OVERRUN                 0x01
+#define MODBUS_SERIAL_ERROR_FRAMING                 0x02
+#define MODBUS_SERIAL_ERROR_PARITY                  0x04
+
+/* Communication counters of FC 0x08, they wrap at 0xFFFF */
+typedef struct _mb_counters_t {
+    uint16_t    bus_message;
+    uint16_t    bus_comm_error;
+    uint16_t    bus_exception;
+    uint16_t    slave_message;
+    uint16_t    slave_no_response;
+    uint16_t    bus_char_overrun;
+} mb_counters_t;
+
+/* One slave instance, see mb_t below */
+typedef struct _mb_t mb_t;
+
+/* Backend serial line, the handlers are called with the context given
+   along with them */
 typedef struct _serial_t {
     const char* name;
     void        (*begin)(uint32_t baud);
     size_t      (*available)(void);
     uint8_t     (*read)(void);
     void        (*write)(uint8_t* buf, const size_t size);
+    /* Optional, pushes each received byte to handler from the RX interrupt */
+    void        (*set_rx_handler)(void (*handler)(mb_t *mb, uint8_t c), mb_t *mb);
+    /* Optional, hands whole frames delimited by the backend to handler,
+       called once mb->rx.t35_ticks is set for the line */
+    void        (*set_frame_handler)(bool (*handler)(mb_t *mb, uint8_t *adu, uint16_t length), mb_t *mb);
+    /* Optional, true while the last written buffer is still being read */
+    bool        (*tx_busy)(void);
+    /* Optional, true once the last written byte left the shift register */
+    bool        (*tx_complete)(void);
+    /* Optional, reports MODBUS_SERIAL_ERROR_* flags from the error interrupt */
+    void        (*set_error_handler)(void (*handler)(mb_t *mb, uint32_t errors), mb_t *mb);
 } serial_t;
 
+/* Registers mapping, one can be shared by several contexts */
+typedef struct _mb_mapping_t {
+    int             nb_bits;
+    int             start_bits;
+    int             nb_input_bits;
+    int             start_input_bits;
+    int             nb_input_registers;
+    int             start_input_registers;
+    int             nb_registers;
+    int             start_registers;
+    uint32_t        tab_bits[MODBUS_BITMAP_WORDS(MODBUS_NB_TAB_BIT)];
+    uint32_t        tab_input_bits[MODBUS_BITMAP_WORDS(MODBUS_NB_TAB_INPUT_BIT)];
+    uint16_t        tab_input_registers[MODBUS_NB_TAB_INPUT_REGISTER];
+    uint16_t        tab_registers[MODBUS_NB_TAB_REGISTER];
+#if MODBUS_STATS
+    /* The one context whose stats are published here */
+    const mb_t      *stats_owner;
+#endif
+} mb_mapping_t;
+
+/* Receive state machine, fed byte by byte from the serial RX path or handed
+   whole frames by backends that delimit them */
+typedef struct _mb_rx_t {
+    uint8_t             adu[MODBUS_MAX_ADU_LENGTH];
+    uint8_t             *frame;
+    uint16_t            length;
+    uint16_t            length_to_read;
+    uint8_t             step;
+    bool                broken;
+    uint16_t            crc;
+    uint32_t            last_ticks;
+    /* One 11-bit character, and the T1.5 and T3.5 silences */
+    uint32_t            char_ticks;
+    uint32_t            t15_ticks;
+    uint32_t            t35_ticks;
+#if MODBUS_STATS
+    uint32_t            first_ticks;
+    uint32_t            end_ticks;
+#endif
+    volatile bool       ready;
+} mb_rx_t;
 
-/* Global Variables */    
-extern int             nb_bits;
-extern int             start_bits;
-extern int             nb_input_bits;
-extern int             start_input_bits;
-extern int             nb_input_registers;
-extern int             start_input_registers;
-extern int             nb_registers;
-extern int             start_registers;
-extern uint8_t         tab_bits[MODBUS_NB_TAB_BIT];
-extern uint8_t         tab_input_bits[MODBUS_NB_TAB_INPUT_BIT];
-extern uint16_t        tab_input_registers[MODBUS_NB_TAB_INPUT_REGISTER];
-extern uint16_t        tab_registers[MODBUS_NB_TAB_REGISTER];
+/* Table written by a request, passed to the write handler */
+#define MODBUS_TABLE_BITS                           0
+#define MODBUS_TABLE_REGISTERS                      1
+
+/* Everything one serial port needs, the application owns the storage and
+   the core never touches another context */
+struct _mb_t {
+    uint8_t             slave;
+    const serial_t      *serial;
+    mb_mapping_t        *mapping;
+    /* Unit mappings, units[0] is mapping, answered as slave */
+    mb_mapping_t        *units[MODBUS_MAX_UNITS];
+    uint8_t             nb_units;
+    /* Slave ID to unit + 1, 0 for IDs nobody answers */
+    uint8_t             unit_index[MODBUS_NB_SLAVE_IDS];
+    /* Mapping of the request being served */
+    mb_mapping_t        *unit;
+    mb_rx_t             rx;
+    mb_counters_t       counters;
+    /* Told about every write once the table holds the new values, unit is
+       the mapping written */
+    void                (*write_handler)(mb_t *mb, int table, int index, int nb);
+    /* rsp_buffer or its uncached alias, replies are sent in place and the
+       backend may still be reading it by DMA */
+    uint8_t             *rsp_adu;
+#if MODBUS_STATS
+    mb_stats_t          stats;
+#endif
+    uint8_t             rsp_buffer[MODBUS_DMA_SIZE(MODBUS_MAX_ADU_LENGTH)]
+                        __attribute__((aligned(MODBUS_DMA_LINE)));
+};
 
 
-void mb_set_slave(uint8_t slave);
-void mb_init(int baud);
-int mb_loop(void);
+void mb_mapping_init(mb_mapping_t *mapping);
+void mb_set_slave(mb_t *mb, uint8_t slave);
+int mb_add_unit(mb_t *mb, uint8_t slave, mb_mapping_t *mapping);
+void mb_set_write_handler(mb_t *mb, void (*handler)(mb_t *mb, int table, int index, int nb));
+void mb_init(mb_t *mb, mb_mapping_t *mapping, const serial_t *port, int baud);
+int mb_loop(mb_t *mb);
+void mb_rx_feed(mb_t *mb, uint8_t c);
+bool mb_rx_frame(mb_t *mb, uint8_t *adu, uint16_t length);
+void mb_rx_error(mb_t *mb, uint32_t errors);
+void mb_set_rx_timing(mb_t *mb, uint32_t baud);
+const mb_counters_t *mb_get_counters(const mb_t *mb);
 
 
 /**
@@ -144,6 +319,14 @@ void modbus_set_bits_from_bytes(uint8_t *dest,
 uint8_t modbus_get_byte_from_bits(const uint8_t *src,
                                              int idx,
                                              unsigned int nb_bits);
+int modbus_bitmap_get_bytes(const uint32_t *src,
+                            int idx,
+                            unsigned int nb_bits,
+                            uint8_t *dest);
+void modbus_bitmap_set_bytes(uint32_t *dest,
+                             int idx,
+                             unsigned int nb_bits,
+                             const uint8_t *tab_byte);
 float modbus_get_float(const uint16_t *src);
 float modbus_get_float_abcd(const uint16_t *src);
 float modbus_get_float_dcba(const uint16_t *src);
@@ -0,0 +1,115 @@
+#include <string.h>
+#include "modbus-stats.h"
+#include "modbus-rtu.h"
+#include "modbus-hal.h"
+
+#if MODBUS_STATS
+
+/* Stage intervals kept per function code */
+enum { _STAGE_RX = 0, _STAGE_CHECK, _STAGE_REPLY, _STAGE_TX, _STAGE_TURNAROUND, _STAGE_TOTAL };
+
+/* First and last stamp of each stage */
+static const uint8_t stage_stamps[MODBUS_STATS_NB_STAGES][2] = {
+    { MODBUS_STATS_FIRST_BYTE,  MODBUS_STATS_LAST_BYTE },
+    { MODBUS_STATS_LAST_BYTE,   MODBUS_STATS_CRC_CHECKED },
+    { MODBUS_STATS_CRC_CHECKED, MODBUS_STATS_REPLY_BUILT },
+    { MODBUS_STATS_REPLY_BUILT, MODBUS_STATS_TX_DONE },
+    { MODBUS_STATS_LAST_BYTE,   MODBUS_STATS_REPLY_BUILT },
+    { MODBUS_STATS_FIRST_BYTE,  MODBUS_STATS_TX_DONE },
+};
+
+/* One block per supported function code, the last one takes the others */
+static const uint8_t block_functions[MODBUS_STATS_NB_BLOCKS] = {
+    MODBUS_FC_READ_COILS,
+    MODBUS_FC_READ_DISCRETE_INPUTS,
+    MODBUS_FC_READ_HOLDING_REGISTERS,
+    MODBUS_FC_READ_INPUT_REGISTERS,
+    MODBUS_FC_WRITE_SINGLE_COIL,
+    MODBUS_FC_WRITE_SINGLE_REGISTER,
+    MODBUS_FC_WRITE_MULTIPLE_COILS,
+    MODBUS_FC_WRITE_MULTIPLE_REGISTERS,
+    MODBUS_FC_MASK_WRITE_REGISTER,
+    MODBUS_FC_WRITE_AND_READ_REGISTERS,
+    0,
+};
+
+static uint16_t ticks_to_us(uint64_t ticks)
+{
+    uint64_t us = ticks / (MODBUS_HAL_TICKS_FREQUENCY / 1000000U);
+
+    return us > 0xFFFF ? 0xFFFF : (uint16_t)us;
+}
+
+static void publish(mb_t *mb, int index)
+{
+    const mb_stats_block_t *block = &mb->stats.blocks[index];
+    uint16_t *reg = mb->stats.registers;
+    int i;
+
+    if (reg == NULL) {
+        return;
+    }
+    reg += index * MODBUS_STATS_BLOCK_REGISTERS;
+    *reg++ = block_functions[index];
+    *reg++ = (uint16_t)block->count;
+    for (i = 0; i < MODBUS_STATS_NB_STAGES; i++) {
+        const mb_stats_stage_t *stage = &block->stage[i];
+
+        *reg++ = ticks_to_us(stage->min);
+        *reg++ = block->count ? ticks_to_us(stage->sum / block->count) : 0;
+        *reg++ = ticks_to_us(stage->max);
+    }
+    memcpy(reg, block->histogram, sizeof(block->histogram));
+}
+
+void mb_stats_record(mb_t *mb, uint8_t function, const uint32_t *stamps)
+{
+    mb_stats_block_t *block;
+    uint32_t us;
+    int index, bin, i;
+
+    for (index = 0; index < MODBUS_STATS_NB_BLOCKS - 1; index++) {
+        if (block_functions[index] == function) {
+            break;
+        }
+    }
+    block = &mb->stats.blocks[index];
+
+    block->count++;
+    for (i = 0; i < MODBUS_STATS_NB_STAGES; i++) {
+        mb_stats_stage_t *stage = &block->stage[i];
+        uint32_t ticks = stamps[stage_stamps[i][1]] - stamps[stage_stamps[i][0]];
+
+        if (block->count == 1 || ticks < stage->min) {
+            stage->min = ticks;
+        }
+        if (ticks > stage->max) {
+            stage->max = ticks;
+        }
+        stage->sum += ticks;
+    }
+
+    /* log2 bin of the turnaround in us */
+    us = ticks_to_us(stamps[MODBUS_STATS_REPLY_BUILT] - stamps[MODBUS_STATS_LAST_BYTE]);
+    bin = us < 2 ? 0 : 31 - __builtin_clz(us);
+    if (bin >= MODBUS_STATS_NB_BINS) {
+        bin = MODBUS_STATS_NB_BINS - 1;
+    }
+    if (block->histogram[bin] != 0xFFFF) {
+        block->histogram[bin]++;
+    }
+
+    publish(mb, index);
+}
+
+void mb_stats_clear(mb_t *mb)
+{
+    int index;
+
+    memset(mb->stats.blocks, 0, sizeof(mb->stats.blocks));
+    for (index = 0; index < MODBUS_STATS_NB_BLOCKS; index++) {
+        publish(mb, index);
+    }
+}
+
+#endif
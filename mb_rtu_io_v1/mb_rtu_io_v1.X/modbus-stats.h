@@ -0,0 +1,102 @@
+/*
+ * File:   modbus-stats.h
+ * Author: thanho
+ *
+ * Per function code latency of the exchange stages
+ */
+
+#ifndef MODBUS_STATS_H
+#define	MODBUS_STATS_H
+
+#include <stdint.h>
+
+/* Per function code latency of each exchange stage, timestamped with
+   mb_hal_ticks() (CP0 Count on the PIC32), off unless MODBUS_STATS is 1 */
+#ifndef MODBUS_STATS
+#define MODBUS_STATS                                0
+#endif
+
+/* Timestamps taken along one exchange */
+#define MODBUS_STATS_FIRST_BYTE                     0
+#define MODBUS_STATS_LAST_BYTE                      1
+#define MODBUS_STATS_CRC_CHECKED                    2
+#define MODBUS_STATS_REPLY_BUILT                    3
+#define MODBUS_STATS_TX_DONE                        4
+#define MODBUS_STATS_NB_STAMPS                      5
+
+/* 
+ * Published in tab_input_registers, one block of 32 registers per function
+ * code, all times in us saturated to 0xFFFF. A mapping shared by several
+ * ports only shows the stats of the first one given to mb_init(), give each
+ * port its own mapping to see them all.
+ *  +0      function code (0 for the catch-all block)
+ *  +1      exchanges, wraps
+ *  +2..4   receive, first to last byte: min, avg, max
+ *  +5..7   CRC check, last byte to CRC checked
+ *  +8..10  reply, CRC checked to reply built
+ *  +11..13 transmit, reply built to last byte sent
+ *  +14..16 turnaround, last byte received to reply built
+ *  +17..19 total, first byte received to last byte sent
+ *  +20..31 turnaround histogram, bin 0 < 2 us, bin k in [2^k, 2^(k+1)) us,
+ *          the last bin takes everything above, counts saturate
+ * The last byte is sent when the backend's tx_complete() says its shift
+ * register is empty, or when it took the reply if it has no tx_complete.
+ */
+#define MODBUS_STATS_BLOCK_REGISTERS                32
+#define MODBUS_STATS_NB_BINS                        12
+#define MODBUS_STATS_NB_BLOCKS                      11
+#define MODBUS_STATS_NB_REGISTERS                   (MODBUS_STATS_NB_BLOCKS * MODBUS_STATS_BLOCK_REGISTERS)
+#define MODBUS_STATS_NB_STAGES                      6
+
+#ifndef MODBUS_STATS_ADDRESS
+#define MODBUS_STATS_ADDRESS                        (MODBUS_NB_TAB_INPUT_REGISTER - MODBUS_STATS_NB_REGISTERS)
+#endif
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+typedef struct _mb_stats_stage_t {
+    uint32_t            min;
+    uint32_t            max;
+    uint64_t            sum;
+} mb_stats_stage_t;
+
+typedef struct _mb_stats_block_t {
+    uint32_t            count;
+    mb_stats_stage_t    stage[MODBUS_STATS_NB_STAGES];
+    uint16_t            histogram[MODBUS_STATS_NB_BINS];
+} mb_stats_block_t;
+
+/* Kept in each context */
+typedef struct _mb_stats_t {
+    mb_stats_block_t    blocks[MODBUS_STATS_NB_BLOCKS];
+    /* Exchange being answered, recorded once its reply is out */
+    uint32_t            stamps[MODBUS_STATS_NB_STAMPS];
+    int                 function;
+    /* Where the blocks are published, NULL when another context owns the
+       stats registers of the mapping */
+    uint16_t            *registers;
+} mb_stats_t;
+
+struct _mb_t;
+
+/**
+ * Account one exchange and refresh its block of input registers
+ * @param mb context, published in its mapping
+ * @param function function code of the request
+ * @param stamps MODBUS_STATS_NB_STAMPS tick values
+ */
+void mb_stats_record(struct _mb_t *mb, uint8_t function, const uint32_t *stamps);
+
+/**
+ * Reset every block
+ * @param mb context
+ */
+void mb_stats_clear(struct _mb_t *mb);
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* MODBUS_STATS_H */
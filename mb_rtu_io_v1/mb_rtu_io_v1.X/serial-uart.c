@@ -0,0 +1,145 @@
+#include "serial-uart.h"
+#include "peripheral/uart/plib_uart3.h"
+#include "peripheral/uart/plib_uart4.h"
+#include "peripheral/uart/plib_uart5.h"
+#include "peripheral/uart/plib_uart6.h"
+
+
+/* One UART instance: its plib entry points and the context it feeds */
+typedef struct _serial_uart_t {
+    bool        (*serial_setup)(UART_SERIAL_SETUP *setup, uint32_t srcClkFreq);
+    uint32_t    frequency;
+    size_t      (*plib_read)(uint8_t *buf, const size_t size);
+    UART_ERROR  (*error_get)(void);
+    void        (*read_callback_register)(UART_RING_BUFFER_CALLBACK callback, uintptr_t context);
+    void        (*read_threshold_set)(uint32_t nBytesThreshold);
+    bool        (*read_notification_enable)(bool isEnabled, bool isPersistent);
+    void        (*rx_handler)(mb_t *mb, uint8_t c);
+    void        (*error_handler)(mb_t *mb, uint32_t errors);
+    mb_t        *mb;
+} serial_uart_t;
+
+
+
+static void serial_uart_begin(serial_uart_t *uart, uint32_t baud)
+{
+    UART_SERIAL_SETUP setup;
+
+    setup.baudRate  = baud;
+    setup.parity    = UART_PARITY_NONE;
+    setup.dataWidth = UART_DATA_8_BIT;
+    setup.stopBits  = UART_STOP_1_BIT;
+
+    uart->serial_setup(&setup, uart->frequency);
+}
+
+static uint8_t serial_uart_read(serial_uart_t *uart)
+{
+    uint8_t c;
+
+    uart->plib_read(&c, 1);
+    return c;
+}
+
+/* Called from UARTn_RX_InterruptHandler each time a byte lands in the ring,
+   and from UARTn_FAULT_InterruptHandler once it flushed a line error, context
+   is the instance */
+static void serial_uart_rx_callback(UART_EVENT event, uintptr_t context)
+{
+    serial_uart_t *uart = (serial_uart_t *)context;
+    uint8_t c;
+
+    if (event == UART_EVENT_READ_ERROR) {
+        UART_ERROR errors = uart->error_get();
+
+        if (uart->error_handler != NULL) {
+            uart->error_handler(uart->mb, ((errors & UART_ERROR_OVERRUN) ? MODBUS_SERIAL_ERROR_OVERRUN : 0)
+                    | ((errors & UART_ERROR_FRAMING) ? MODBUS_SERIAL_ERROR_FRAMING : 0)
+                    | ((errors & UART_ERROR_PARITY) ? MODBUS_SERIAL_ERROR_PARITY : 0));
+        }
+        return;
+    }
+    if (event != UART_EVENT_READ_THRESHOLD_REACHED || uart->rx_handler == NULL) {
+        return;
+    }
+    while (uart->plib_read(&c, 1) == 1) {
+        uart->rx_handler(uart->mb, c);
+    }
+}
+
+static void serial_uart_set_error_handler(serial_uart_t *uart,
+        void (*handler)(mb_t *mb, uint32_t errors), mb_t *mb)
+{
+    uart->mb = mb;
+    uart->error_handler = handler;
+
+    /* The fault interrupt reports through the read callback */
+    uart->read_callback_register(serial_uart_rx_callback, (uintptr_t)uart);
+}
+
+static void serial_uart_set_rx_handler(serial_uart_t *uart,
+        void (*handler)(mb_t *mb, uint8_t c), mb_t *mb)
+{
+    uart->mb = mb;
+    uart->rx_handler = handler;
+
+    uart->read_callback_register(serial_uart_rx_callback, (uintptr_t)uart);
+    uart->read_threshold_set(1);
+    uart->read_notification_enable(handler != NULL, true);
+}
+
+/* serial_t entries take no instance, bind each one to its UART. Write
+   returns at once, UARTn_Write() copies the buffer into the TX ring */
+#define SERIAL_UART(n)                                                          \
+static serial_uart_t uart##n##_instance = {                                     \
+    .serial_setup           = UART##n##_SerialSetup,                            \
+    .frequency              = UART##n##_FrequencyGet(),                         \
+    .plib_read              = UART##n##_Read,                                   \
+    .error_get              = UART##n##_ErrorGet,                               \
+    .read_callback_register = UART##n##_ReadCallbackRegister,                   \
+    .read_threshold_set     = UART##n##_ReadThresholdSet,                       \
+    .read_notification_enable = UART##n##_ReadNotificationEnable,               \
+};                                                                              \
+static void uart##n##_begin(uint32_t baud)                                      \
+{                                                                               \
+    serial_uart_begin(&uart##n##_instance, baud);                               \
+}                                                                               \
+static size_t uart##n##_available(void)                                         \
+{                                                                               \
+    return UART##n##_ReadCountGet();                                            \
+}                                                                               \
+static uint8_t uart##n##_read(void)                                             \
+{                                                                               \
+    return serial_uart_read(&uart##n##_instance);                               \
+}                                                                               \
+static void uart##n##_write(uint8_t* buf, const size_t size)                    \
+{                                                                               \
+    UART##n##_Write(buf, size);                                                 \
+}                                                                               \
+static bool uart##n##_tx_complete(void)                                         \
+{                                                                               \
+    return UART##n##_WriteCountGet() == 0U && UART##n##_TransmitComplete();     \
+}                                                                               \
+static void uart##n##_set_rx_handler(void (*handler)(mb_t *mb, uint8_t c), mb_t *mb) \
+{                                                                               \
+    serial_uart_set_rx_handler(&uart##n##_instance, handler, mb);               \
+}                                                                               \
+static void uart##n##_set_error_handler(void (*handler)(mb_t *mb, uint32_t errors), mb_t *mb) \
+{                                                                               \
+    serial_uart_set_error_handler(&uart##n##_instance, handler, mb);            \
+}                                                                               \
+const serial_t uart##n = {                                                      \
+    .name           = "UART" #n,                                                \
+    .begin          = uart##n##_begin,                                          \
+    .available      = uart##n##_available,                                      \
+    .read           = uart##n##_read,                                           \
+    .write          = uart##n##_write,                                          \
+    .tx_complete    = uart##n##_tx_complete,                                    \
+    .set_rx_handler = uart##n##_set_rx_handler,                                 \
+    .set_error_handler = uart##n##_set_error_handler,                           \
+}
+
+SERIAL_UART(3);
+SERIAL_UART(4);
+SERIAL_UART(5);
+SERIAL_UART(6);
@@ -0,0 +1,28 @@
+/*
+ * File:   serial-uart.h
+ * Author: thanho
+ *
+ * serial_t backends on the UART3..UART6 ring buffer drivers
+ */
+
+#ifndef SERIAL_UART_H
+#define	SERIAL_UART_H
+
+#include "modbus-rtu.h"
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+/* UART3..UART6 on the Harmony interrupt ring buffer driver, one RX interrupt
+   per byte, each backend hands its bytes to its own mb_t */
+extern const serial_t uart3;
+extern const serial_t uart4;
+extern const serial_t uart5;
+extern const serial_t uart6;
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* SERIAL_UART_H */
@@ -0,0 +1,265 @@
+#include "serial-uart1.h"
+#include "peripheral/uart/plib_uart1.h"
+#if SERIAL_UART1_TX_DMA || SERIAL_UART1_RX_DMA
+#include "device.h"
+#include "peripheral/dmac/plib_dmac.h"
+#endif
+#if SERIAL_UART1_RX_DMA
+#include "peripheral/tmr/plib_tmr2.h"
+#include "modbus-hal.h"
+#endif
+
+
+static UART_SERIAL_SETUP setup;
+#if !SERIAL_UART1_RX_DMA
+static void (*uart1_rx_handler)(mb_t *mb, uint8_t c);
+#endif
+static void (*uart1_error_handler)(mb_t *mb, uint32_t errors);
+/* Context given with the handlers */
+static mb_t *uart1_mb;
+#if SERIAL_UART1_TX_DMA
+static volatile bool uart1_tx_pending;
+#endif
+#if SERIAL_UART1_RX_DMA
+/* The DMA fills one buffer while the core parses the other in place */
+static uint8_t uart1_rx_adu[2][MODBUS_MAX_ADU_LENGTH] MODBUS_DMA_BUFFER;
+static uint8_t uart1_rx_index;
+static uint32_t uart1_rx_count;
+static uint32_t uart1_rx_last_ticks;
+static uint32_t uart1_rx_t35_ticks;
+/* A line error aborted the frame being received, its rest is dropped too */
+static bool uart1_rx_bad;
+static bool (*uart1_frame_handler)(mb_t *mb, uint8_t *adu, uint16_t length);
+#endif
+
+/* U1STA error bits to MODBUS_SERIAL_ERROR_* */
+static uint32_t uart1_errors(UART_ERROR errors)
+{
+    return ((errors & UART_ERROR_OVERRUN) ? MODBUS_SERIAL_ERROR_OVERRUN : 0)
+            | ((errors & UART_ERROR_FRAMING) ? MODBUS_SERIAL_ERROR_FRAMING : 0)
+            | ((errors & UART_ERROR_PARITY) ? MODBUS_SERIAL_ERROR_PARITY : 0);
+}
+
+#if SERIAL_UART1_TX_DMA
+/* Called from DMA0_InterruptHandler once the whole buffer went to U1TXREG */
+static void uart1_tx_dma_callback(DMAC_TRANSFER_EVENT event, uintptr_t context)
+{
+    uart1_tx_pending = false;
+}
+#endif
+
+#if SERIAL_UART1_RX_DMA
+static void uart1_rx_dma_start(void)
+{
+    uart1_rx_count = 0;
+    DMAC_ChannelTransfer(DMAC_CHANNEL_1, (const void *)&U1RXREG, 1,
+            uart1_rx_adu[uart1_rx_index], MODBUS_MAX_ADU_LENGTH, 1);
+    /* Bytes that landed in the FIFO while the channel was off raise no new
+       request, pull the first one by hand */
+    if ((U1STA & _U1STA_URXDA_MASK) != 0U) {
+        DCH1ECONSET = _DCH1ECON_CFORCE_MASK;
+    }
+}
+
+/* Called from DMA1_InterruptHandler when MODBUS_MAX_ADU_LENGTH bytes came
+   without a T3.5 silence, on a bus error, or when a UART1 line error aborted
+   the channel: the frame is dropped */
+static void uart1_rx_dma_callback(DMAC_TRANSFER_EVENT event, uintptr_t context)
+{
+    if (event == DMAC_TRANSFER_EVENT_ABORT) {
+        UART_ERROR errors = (UART_ERROR)(U1STA & (_U1STA_OERR_MASK | _U1STA_FERR_MASK | _U1STA_PERR_MASK));
+
+        /* The channel is stopped, clearing OERR may reset the FIFO. The bytes
+           in it go to the DMA again and are dropped with the frame, which is
+           reported here only */
+        U1STACLR = _U1STA_OERR_MASK;
+        IFS3CLR = _IFS3_U1EIF_MASK;
+        uart1_rx_bad = true;
+        uart1_rx_last_ticks = mb_hal_ticks();
+        if (uart1_error_handler != NULL) {
+            uart1_error_handler(uart1_mb, uart1_errors(errors));
+        }
+    }
+    uart1_rx_dma_start();
+}
+
+/* Called from TIMER_2_InterruptHandler a few times per T3.5, the DMA
+   destination pointer tells whether bytes came since the previous tick */
+static void uart1_rx_idle_check(uint32_t status, uintptr_t context)
+{
+    uint32_t now = mb_hal_ticks();
+    uint32_t count = DMAC_ChannelGetTransferredCount(DMAC_CHANNEL_1);
+
+    if (count != uart1_rx_count) {
+        uart1_rx_count = count;
+        uart1_rx_last_ticks = now;
+    }
+    else if ((count != 0U || uart1_rx_bad) && (now - uart1_rx_last_ticks) >= uart1_rx_t35_ticks) {
+        DMAC_ChannelDisable(DMAC_CHANNEL_1);
+        count = DMAC_ChannelGetTransferredCount(DMAC_CHANNEL_1);
+        /* A taken buffer belongs to the core until it takes the next one,
+           by then it is done with it. A broken frame was reported when its
+           line error aborted the channel, the core never sees it */
+        if (uart1_rx_bad) {
+            uart1_rx_bad = false;
+        }
+        else if (uart1_frame_handler != NULL
+                && uart1_frame_handler(uart1_mb, uart1_rx_adu[uart1_rx_index], count)) {
+            uart1_rx_index ^= 1U;
+        }
+        uart1_rx_dma_start();
+    }
+}
+#endif
+
+static void uart1_begin(uint32_t baud)
+{   
+    setup.baudRate  = baud;
+    setup.parity    = UART_PARITY_NONE;
+    setup.dataWidth = UART_DATA_8_BIT;
+    setup.stopBits  = UART_STOP_1_BIT;
+    
+    UART1_SerialSetup(&setup, UART1_FrequencyGet());
+
+#if SERIAL_UART1_TX_DMA
+    /* UTXISEL = 0: request a byte as long as the TX FIFO has room, the TX
+       interrupt itself stays disabled, only the DMA listens to it */
+    U1STACLR = _U1STA_UTXISEL_MASK;
+    DMAC_ChannelCallbackRegister(DMAC_CHANNEL_0, uart1_tx_dma_callback, 0);
+#endif
+#if SERIAL_UART1_RX_DMA
+    /* The DMA alone listens to the RX request and to line errors, which abort
+       the channel. The fault interrupt would flush the FIFO under it */
+    IEC3CLR = _IEC3_U1RXIE_MASK | _IEC3_U1EIE_MASK;
+    uart1_rx_bad = false;
+    DMAC_ChannelCallbackRegister(DMAC_CHANNEL_1, uart1_rx_dma_callback, 0);
+    uart1_rx_index = 0;
+    uart1_rx_dma_start();
+#endif
+}
+
+static size_t uart1_available(void)
+{
+    return UART1_ReadCountGet();
+}
+
+static uint8_t uart1_read(void)
+{
+    uint8_t c;
+   
+    UART1_Read(&c, 1);
+    return c;
+}
+
+static void uart1_write(uint8_t* buf, const size_t size)
+{
+#if SERIAL_UART1_TX_DMA
+    /* The DMA reads buf in place, one cell per TX request, so it must be
+       coherent and left alone until uart1_tx_busy() returns false */
+    uart1_tx_pending = true;
+    if (!DMAC_ChannelTransfer(DMAC_CHANNEL_0, buf, size, (const void *)&U1TXREG, 1, 1)) {
+        uart1_tx_pending = false;
+    }
+#else
+    UART1_Write(buf, size);
+#endif
+}
+
+static bool uart1_tx_busy(void)
+{
+#if SERIAL_UART1_TX_DMA
+    return uart1_tx_pending;
+#else
+    /* UART1_Write() copied the buffer into its ring */
+    return false;
+#endif
+}
+
+/* The DMA or the ring is done and U1STA.TRMT says the shift register is
+   empty, the last stop bit is on the line */
+static bool uart1_tx_complete(void)
+{
+#if SERIAL_UART1_TX_DMA
+    return !uart1_tx_pending && UART1_TransmitComplete();
+#else
+    return UART1_WriteCountGet() == 0U && UART1_TransmitComplete();
+#endif
+}
+
+#if !SERIAL_UART1_RX_DMA
+/* Called from UART1_RX_InterruptHandler each time a byte lands in the ring,
+   and from UART1_FAULT_InterruptHandler once it flushed a line error */
+static void uart1_rx_callback(UART_EVENT event, uintptr_t context)
+{
+    uint8_t c;
+
+    if (event == UART_EVENT_READ_ERROR) {
+        UART_ERROR errors = UART1_ErrorGet();
+
+        if (uart1_error_handler != NULL) {
+            uart1_error_handler(uart1_mb, uart1_errors(errors));
+        }
+        return;
+    }
+    if (event != UART_EVENT_READ_THRESHOLD_REACHED || uart1_rx_handler == NULL) {
+        return;
+    }
+    while (UART1_Read(&c, 1) == 1) {
+        uart1_rx_handler(uart1_mb, c);
+    }
+}
+#endif
+
+#if SERIAL_UART1_RX_DMA
+/* Frames are delimited with the T3.5 the core computed for mb */
+static void uart1_set_frame_handler(bool (*handler)(mb_t *mb, uint8_t *adu, uint16_t length), mb_t *mb)
+{
+    TMR2_Stop();
+    uart1_mb = mb;
+    uart1_frame_handler = handler;
+    uart1_rx_t35_ticks = mb->rx.t35_ticks;
+    /* Four idle checks per T3.5, a frame ends at most T3.5 / 4 late */
+    TMR2_PeriodSet((uint16_t)(((uint64_t)uart1_rx_t35_ticks * TMR2_FrequencyGet()) / (4U * MODBUS_HAL_TICKS_FREQUENCY)));
+    TMR2_CallbackRegister(uart1_rx_idle_check, 0);
+    TMR2_Start();
+}
+#endif
+
+static void uart1_set_error_handler(void (*handler)(mb_t *mb, uint32_t errors), mb_t *mb)
+{
+    uart1_mb = mb;
+    uart1_error_handler = handler;
+
+#if !SERIAL_UART1_RX_DMA
+    /* The fault interrupt reports through the read callback */
+    UART1_ReadCallbackRegister(uart1_rx_callback, 0);
+#endif
+}
+
+#if !SERIAL_UART1_RX_DMA
+static void uart1_set_rx_handler(void (*handler)(mb_t *mb, uint8_t c), mb_t *mb)
+{
+    uart1_mb = mb;
+    uart1_rx_handler = handler;
+
+    UART1_ReadCallbackRegister(uart1_rx_callback, 0);
+    UART1_ReadThresholdSet(1);
+    UART1_ReadNotificationEnable(handler != NULL, true);
+}
+#endif
+
+const serial_t uart1 = {
+    .name           = "UART1",
+    .begin          = uart1_begin,
+    .available      = uart1_available,
+    .read           = uart1_read,
+    .write          = uart1_write,
+#if SERIAL_UART1_RX_DMA
+    .set_frame_handler = uart1_set_frame_handler,
+#else
+    .set_rx_handler = uart1_set_rx_handler,
+#endif
+    .tx_busy        = uart1_tx_busy,
+    .tx_complete    = uart1_tx_complete,
+    .set_error_handler = uart1_set_error_handler,
+};
@@ -0,0 +1,34 @@
+/*
+ * File:   serial-uart1.h
+ * Author: thanho
+ *
+ * serial_t backend on UART1, DMA transmit and receive
+ */
+
+#ifndef SERIAL_UART1_H
+#define	SERIAL_UART1_H
+
+#include "modbus-rtu.h"
+
+/* Send responses with DMAC_CHANNEL_0 instead of the UART1 TX ring buffer */
+#ifndef SERIAL_UART1_TX_DMA
+#define SERIAL_UART1_TX_DMA                         1
+#endif
+
+/* Receive whole frames with DMAC_CHANNEL_1, delimited by a TMR2 T3.5 idle
+   check, instead of one RX interrupt per byte */
+#ifndef SERIAL_UART1_RX_DMA
+#define SERIAL_UART1_RX_DMA                         1
+#endif
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+extern const serial_t uart1;
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* SERIAL_UART1_H */
@@ -211,10 +211,24 @@ void SYS_Initialize ( void* data )
 	GPIO_Initialize();
 
     CORETIMER_Initialize();
+	TMR2_Initialize();
+
+	TMR3_Initialize();
+
 	UART1_Initialize();
 
 	UART2_Initialize();
 
+	UART3_Initialize();
+
+	UART4_Initialize();
+
+	UART5_Initialize();
+
+	UART6_Initialize();
+
+    DMAC_Initialize();
+
 
     EVIC_Initialize();
 
@@ -66,9 +66,25 @@
 // Section: System Interrupt Vector declarations
 // *****************************************************************************
 // *****************************************************************************
+void TIMER_2_Handler (void);
+void TIMER_3_Handler (void);
 void UART1_FAULT_Handler (void);
 void UART1_RX_Handler (void);
 void UART1_TX_Handler (void);
+void DMA0_Handler (void);
+void DMA1_Handler (void);
+void UART3_FAULT_Handler (void);
+void UART3_RX_Handler (void);
+void UART3_TX_Handler (void);
+void UART4_FAULT_Handler (void);
+void UART4_RX_Handler (void);
+void UART4_TX_Handler (void);
+void UART5_FAULT_Handler (void);
+void UART5_RX_Handler (void);
+void UART5_TX_Handler (void);
+void UART6_FAULT_Handler (void);
+void UART6_RX_Handler (void);
+void UART6_TX_Handler (void);
 
 
 // *****************************************************************************
@@ -76,6 +92,16 @@ void UART1_TX_Handler (void);
 // Section: System Interrupt Vector definitions
 // *****************************************************************************
 // *****************************************************************************
+void __attribute__((used)) __ISR(_TIMER_2_VECTOR, ipl1SRS) TIMER_2_Handler (void)
+{
+    TIMER_2_InterruptHandler();
+}
+
+void __attribute__((used)) __ISR(_TIMER_3_VECTOR, ipl1SRS) TIMER_3_Handler (void)
+{
+    TIMER_3_InterruptHandler();
+}
+
 void __attribute__((used)) __ISR(_UART1_FAULT_VECTOR, ipl1SRS) UART1_FAULT_Handler (void)
 {
     UART1_FAULT_InterruptHandler();
@@ -91,6 +117,76 @@ void __attribute__((used)) __ISR(_UART1_TX_VECTOR, ipl1SRS) UART1_TX_Handler (vo
     UART1_TX_InterruptHandler();
 }
 
+void __attribute__((used)) __ISR(_DMA0_VECTOR, ipl1SRS) DMA0_Handler (void)
+{
+    DMA0_InterruptHandler();
+}
+
+void __attribute__((used)) __ISR(_DMA1_VECTOR, ipl1SRS) DMA1_Handler (void)
+{
+    DMA1_InterruptHandler();
+}
+
+void __attribute__((used)) __ISR(_UART3_FAULT_VECTOR, ipl1SRS) UART3_FAULT_Handler (void)
+{
+    UART3_FAULT_InterruptHandler();
+}
+
+void __attribute__((used)) __ISR(_UART3_RX_VECTOR, ipl1SRS) UART3_RX_Handler (void)
+{
+    UART3_RX_InterruptHandler();
+}
+
+void __attribute__((used)) __ISR(_UART3_TX_VECTOR, ipl1SRS) UART3_TX_Handler (void)
+{
+    UART3_TX_InterruptHandler();
+}
+
+void __attribute__((used)) __ISR(_UART4_FAULT_VECTOR, ipl1SRS) UART4_FAULT_Handler (void)
+{
+    UART4_FAULT_InterruptHandler();
+}
+
+void __attribute__((used)) __ISR(_UART4_RX_VECTOR, ipl1SRS) UART4_RX_Handler (void)
+{
+    UART4_RX_InterruptHandler();
+}
+
+void __attribute__((used)) __ISR(_UART4_TX_VECTOR, ipl1SRS) UART4_TX_Handler (void)
+{
+    UART4_TX_InterruptHandler();
+}
+
+void __attribute__((used)) __ISR(_UART5_FAULT_VECTOR, ipl1SRS) UART5_FAULT_Handler (void)
+{
+    UART5_FAULT_InterruptHandler();
+}
+
+void __attribute__((used)) __ISR(_UART5_RX_VECTOR, ipl1SRS) UART5_RX_Handler (void)
+{
+    UART5_RX_InterruptHandler();
+}
+
+void __attribute__((used)) __ISR(_UART5_TX_VECTOR, ipl1SRS) UART5_TX_Handler (void)
+{
+    UART5_TX_InterruptHandler();
+}
+
+void __attribute__((used)) __ISR(_UART6_FAULT_VECTOR, ipl1SRS) UART6_FAULT_Handler (void)
+{
+    UART6_FAULT_InterruptHandler();
+}
+
+void __attribute__((used)) __ISR(_UART6_RX_VECTOR, ipl1SRS) UART6_RX_Handler (void)
+{
+    UART6_RX_InterruptHandler();
+}
+
+void __attribute__((used)) __ISR(_UART6_TX_VECTOR, ipl1SRS) UART6_TX_Handler (void)
+{
+    UART6_TX_InterruptHandler();
+}
+
 
 
 
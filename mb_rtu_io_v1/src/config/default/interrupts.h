@@ -57,9 +57,25 @@
 // *****************************************************************************
 // *****************************************************************************
 
+void TIMER_2_InterruptHandler( void );
+void TIMER_3_InterruptHandler( void );
 void UART1_FAULT_InterruptHandler( void );
 void UART1_RX_InterruptHandler( void );
 void UART1_TX_InterruptHandler( void );
+void DMA0_InterruptHandler( void );
+void DMA1_InterruptHandler( void );
+void UART3_FAULT_InterruptHandler( void );
+void UART3_RX_InterruptHandler( void );
+void UART3_TX_InterruptHandler( void );
+void UART4_FAULT_InterruptHandler( void );
+void UART4_RX_InterruptHandler( void );
+void UART4_TX_InterruptHandler( void );
+void UART5_FAULT_InterruptHandler( void );
+void UART5_RX_InterruptHandler( void );
+void UART5_TX_InterruptHandler( void );
+void UART6_FAULT_InterruptHandler( void );
+void UART6_RX_InterruptHandler( void );
+void UART6_TX_InterruptHandler( void );
 
 
 
@@ -96,8 +96,8 @@ void CLK_Initialize( void )
     PMD1 = 0x1001U;
     PMD2 = 0x3U;
     PMD3 = 0x1ff01ffU;
-    PMD4 = 0x1ffU;
-    PMD5 = 0x301f3f3cU;
+    PMD4 = 0x1f9U;
+    PMD5 = 0x301f3f00U;
     PMD6 = 0x10830001U;
     PMD7 = 0x500000U;
 
@@ -0,0 +1,194 @@
+/*******************************************************************************
+  Direct Memory Access Controller (DMAC) PLIB
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    plib_dmac.c
+
+  Summary:
+    DMAC PLIB Implementation File
+
+  Description:
+    None
+
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2019 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#include <sys/kmem.h>
+#include "device.h"
+#include "plib_dmac.h"
+#include "interrupts.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: DMAC Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+/* Channel register blocks are 0xC0 bytes apart */
+#define DMAC_CHANNEL_OFFSET         (0xC0U / sizeof(uint32_t))
+#define DMAC_REG(reg, channel)      (*(&(reg) + ((channel) * DMAC_CHANNEL_OFFSET)))
+
+#define DMAC_INT_FLAGS_MASK         (_DCH0INT_CHERIF_MASK | _DCH0INT_CHTAIF_MASK | _DCH0INT_CHBCIF_MASK)
+
+static DMAC_CHANNEL_OBJECT dmacChannelObj[DMAC_CHANNELS_NUMBER];
+
+void DMAC_Initialize( void )
+{
+    uint32_t channel;
+
+    /* Enable the DMA module */
+    DMACONSET = _DMACON_ON_MASK;
+
+    for (channel = 0U; channel < DMAC_CHANNELS_NUMBER; channel++)
+    {
+        dmacChannelObj[channel].inUse = false;
+        dmacChannelObj[channel].pEventCallBack = NULL;
+        dmacChannelObj[channel].hContext = 0;
+    }
+
+    /* DMAC_CHANNEL_0: UART1 TX, one byte per UART1_TX request */
+    DCH0CON = 0x3U;    /* CHPRI = 3 */
+    DCH0ECON = (((uint32_t)_UART1_TX_VECTOR << _DCH0ECON_CHSIRQ_POSITION) | _DCH0ECON_SIRQEN_MASK);
+    DCH0INT = (_DCH0INT_CHBCIE_MASK | _DCH0INT_CHTAIE_MASK | _DCH0INT_CHERIE_MASK);
+
+    /* DMAC_CHANNEL_1: UART1 RX, one byte per UART1_RX request, aborted by a
+       UART1_FAULT line error */
+    DCH1CON = 0x3U;    /* CHPRI = 3 */
+    DCH1ECON = (((uint32_t)_UART1_RX_VECTOR << _DCH1ECON_CHSIRQ_POSITION) | _DCH1ECON_SIRQEN_MASK
+             | ((uint32_t)_UART1_FAULT_VECTOR << _DCH1ECON_CHAIRQ_POSITION) | _DCH1ECON_AIRQEN_MASK);
+    DCH1INT = (_DCH1INT_CHBCIE_MASK | _DCH1INT_CHTAIE_MASK | _DCH1INT_CHERIE_MASK);
+
+    /* Enable DMA0 and DMA1 Interrupts */
+    IFS4CLR = (_IFS4_DMA0IF_MASK | _IFS4_DMA1IF_MASK);
+    IEC4SET = (_IEC4_DMA0IE_MASK | _IEC4_DMA1IE_MASK);
+}
+
+void DMAC_ChannelCallbackRegister( DMAC_CHANNEL channel, const DMAC_CHANNEL_CALLBACK eventHandler, const uintptr_t contextHandle )
+{
+    dmacChannelObj[channel].pEventCallBack = eventHandler;
+
+    dmacChannelObj[channel].hContext = contextHandle;
+}
+
+bool DMAC_ChannelTransfer( DMAC_CHANNEL channel, const void *srcAddr, size_t srcSize, const void *destAddr, size_t destSize, size_t cellSize )
+{
+    bool returnStatus = false;
+
+    if (DMAC_ChannelIsBusy(channel) == false)
+    {
+        dmacChannelObj[channel].inUse = true;
+
+        /* Clear pending events of the previous transfer */
+        DMAC_REG(DCH0INTCLR, channel) = DMAC_INT_FLAGS_MASK;
+
+        DMAC_REG(DCH0SSA, channel) = (uint32_t)KVA_TO_PA(srcAddr);
+        DMAC_REG(DCH0DSA, channel) = (uint32_t)KVA_TO_PA(destAddr);
+        DMAC_REG(DCH0SSIZ, channel) = srcSize;
+        DMAC_REG(DCH0DSIZ, channel) = destSize;
+        DMAC_REG(DCH0CSIZ, channel) = cellSize;
+
+        DMAC_REG(DCH0CONSET, channel) = _DCH0CON_CHEN_MASK;
+
+        /* Software start when the channel has no start IRQ */
+        if ((DMAC_REG(DCH0ECON, channel) & _DCH0ECON_SIRQEN_MASK) == 0U)
+        {
+            DMAC_REG(DCH0ECONSET, channel) = _DCH0ECON_CFORCE_MASK;
+        }
+
+        returnStatus = true;
+    }
+
+    return returnStatus;
+}
+
+void DMAC_ChannelDisable( DMAC_CHANNEL channel )
+{
+    DMAC_REG(DCH0CONCLR, channel) = _DCH0CON_CHEN_MASK;
+
+    while ((DMAC_REG(DCH0CON, channel) & _DCH0CON_CHBUSY_MASK) != 0U)
+    {
+        /* Wait for the current cell to complete */
+    }
+
+    dmacChannelObj[channel].inUse = false;
+}
+
+bool DMAC_ChannelIsBusy( DMAC_CHANNEL channel )
+{
+    return (dmacChannelObj[channel].inUse == true);
+}
+
+/* Bytes written to the destination since the transfer started */
+uint32_t DMAC_ChannelGetTransferredCount( DMAC_CHANNEL channel )
+{
+    return DMAC_REG(DCH0DPTR, channel);
+}
+
+static void DMAC_ChannelHandler( DMAC_CHANNEL channel )
+{
+    DMAC_TRANSFER_EVENT event = DMAC_TRANSFER_EVENT_NONE;
+    uint32_t flags = DMAC_REG(DCH0INT, channel) & DMAC_INT_FLAGS_MASK;
+
+    if ((flags & _DCH0INT_CHERIF_MASK) != 0U)
+    {
+        event = DMAC_TRANSFER_EVENT_ERROR;
+    }
+    else if ((flags & _DCH0INT_CHTAIF_MASK) != 0U)
+    {
+        event = DMAC_TRANSFER_EVENT_ABORT;
+    }
+    else if ((flags & _DCH0INT_CHBCIF_MASK) != 0U)
+    {
+        event = DMAC_TRANSFER_EVENT_COMPLETE;
+    }
+    else
+    {
+        /* Nothing to report */
+    }
+
+    dmacChannelObj[channel].inUse = false;
+
+    /* Clear the channel and the EVIC flags */
+    DMAC_REG(DCH0INTCLR, channel) = flags;
+    IFS4CLR = (_IFS4_DMA0IF_MASK << channel);
+
+    if (dmacChannelObj[channel].pEventCallBack != NULL)
+    {
+        dmacChannelObj[channel].pEventCallBack(event, dmacChannelObj[channel].hContext);
+    }
+}
+
+void __attribute__((used)) DMA0_InterruptHandler( void )
+{
+    DMAC_ChannelHandler(DMAC_CHANNEL_0);
+}
+
+void __attribute__((used)) DMA1_InterruptHandler( void )
+{
+    DMAC_ChannelHandler(DMAC_CHANNEL_1);
+}
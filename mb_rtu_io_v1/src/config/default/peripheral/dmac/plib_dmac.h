@@ -0,0 +1,127 @@
+/*******************************************************************************
+  Direct Memory Access Controller (DMAC) PLIB
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    plib_dmac.h
+
+  Summary:
+    DMAC PLIB Header File
+
+  Description:
+    None
+
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2019 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#ifndef PLIB_DMAC_H
+#define PLIB_DMAC_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+#define DMAC_CHANNEL_0      (0U)
+#define DMAC_CHANNEL_1      (1U)
+
+/* Number of channels set up by DMAC_Initialize */
+#define DMAC_CHANNELS_NUMBER    (2U)
+
+typedef uint32_t DMAC_CHANNEL;
+
+#define DMAC_TRANSFER_EVENT_NONE        (0U)
+
+/* Block transfer completed */
+#define DMAC_TRANSFER_EVENT_COMPLETE    (1U)
+
+/* Transfer aborted by an abort IRQ or DMAC_ChannelDisable */
+#define DMAC_TRANSFER_EVENT_ABORT       (2U)
+
+/* Address error */
+#define DMAC_TRANSFER_EVENT_ERROR       (4U)
+
+typedef uint32_t DMAC_TRANSFER_EVENT;
+
+typedef void (*DMAC_CHANNEL_CALLBACK) (DMAC_TRANSFER_EVENT event, uintptr_t contextHandle);
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local: **** Do Not Use ****
+// *****************************************************************************
+// *****************************************************************************
+
+typedef struct
+{
+    bool                    inUse;
+
+    DMAC_CHANNEL_CALLBACK   pEventCallBack;
+
+    uintptr_t               hContext;
+
+} DMAC_CHANNEL_OBJECT;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface
+// *****************************************************************************
+// *****************************************************************************
+
+void DMAC_Initialize( void );
+
+void DMAC_ChannelCallbackRegister( DMAC_CHANNEL channel, const DMAC_CHANNEL_CALLBACK eventHandler, const uintptr_t contextHandle );
+
+bool DMAC_ChannelTransfer( DMAC_CHANNEL channel, const void *srcAddr, size_t srcSize, const void *destAddr, size_t destSize, size_t cellSize );
+
+void DMAC_ChannelDisable( DMAC_CHANNEL channel );
+
+bool DMAC_ChannelIsBusy( DMAC_CHANNEL channel );
+
+uint32_t DMAC_ChannelGetTransferredCount( DMAC_CHANNEL channel );
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif // PLIB_DMAC_H
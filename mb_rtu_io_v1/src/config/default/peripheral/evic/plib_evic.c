@@ -56,9 +56,25 @@ void EVIC_Initialize( void )
     INTCONSET = _INTCON_MVEC_MASK;
 
     /* Set up priority and subpriority of enabled interrupts */
+    IPC2SET = 0x400U | 0x0U;  /* TIMER_2:  Priority 1 / Subpriority 0 */
+    IPC3SET = 0x40000U | 0x0U;  /* TIMER_3:  Priority 1 / Subpriority 0 */
     IPC28SET = 0x4U | 0x0U;  /* UART1_FAULT:  Priority 1 / Subpriority 0 */
     IPC28SET = 0x400U | 0x0U;  /* UART1_RX:  Priority 1 / Subpriority 0 */
     IPC28SET = 0x40000U | 0x0U;  /* UART1_TX:  Priority 1 / Subpriority 0 */
+    IPC33SET = 0x40000U | 0x0U;  /* DMA0:  Priority 1 / Subpriority 0 */
+    IPC33SET = 0x4000000U | 0x0U;  /* DMA1:  Priority 1 / Subpriority 0 */
+    IPC38SET = 0x4000000U | 0x0U;  /* UART3_FAULT:  Priority 1 / Subpriority 0 */
+    IPC39SET = 0x4U | 0x0U;  /* UART3_RX:  Priority 1 / Subpriority 0 */
+    IPC39SET = 0x400U | 0x0U;  /* UART3_TX:  Priority 1 / Subpriority 0 */
+    IPC42SET = 0x40000U | 0x0U;  /* UART4_FAULT:  Priority 1 / Subpriority 0 */
+    IPC42SET = 0x4000000U | 0x0U;  /* UART4_RX:  Priority 1 / Subpriority 0 */
+    IPC43SET = 0x4U | 0x0U;  /* UART4_TX:  Priority 1 / Subpriority 0 */
+    IPC44SET = 0x4000000U | 0x0U;  /* UART5_FAULT:  Priority 1 / Subpriority 0 */
+    IPC45SET = 0x4U | 0x0U;  /* UART5_RX:  Priority 1 / Subpriority 0 */
+    IPC45SET = 0x400U | 0x0U;  /* UART5_TX:  Priority 1 / Subpriority 0 */
+    IPC47SET = 0x4U | 0x0U;  /* UART6_FAULT:  Priority 1 / Subpriority 0 */
+    IPC47SET = 0x400U | 0x0U;  /* UART6_RX:  Priority 1 / Subpriority 0 */
+    IPC47SET = 0x40000U | 0x0U;  /* UART6_TX:  Priority 1 / Subpriority 0 */
 
 
 
@@ -86,10 +86,18 @@ void GPIO_Initialize ( void )
     /* PPS Input Remapping */
     U2RXR = 1;
     U1RXR = 3;
+    U3RXR = 3;
+    U4RXR = 3;
+    U5RXR = 0;
+    U6RXR = 6;
 
     /* PPS Output Remapping */
     RPB14R = 2;
     RPF5R = 1;
+    RPD14R = 1;
+    RPD4R = 2;
+    RPD3R = 3;
+    RPD9R = 4;
 
         /* Lock back the system after PPS configuration */
     CFGCONbits.IOLOCK = 1U;
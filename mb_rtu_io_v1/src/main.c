@@ -28,39 +28,78 @@
 #include "definitions.h"                // SYS function prototypes
 
 #include "../mb_rtu_io_v1.X/modbus-rtu.h"
+#include "../mb_rtu_io_v1.X/serial-uart1.h"
+#include "../mb_rtu_io_v1.X/serial-uart.h"
 #include "../mb_rtu_io_v1.X/ioctl.h"
+#include "../mb_rtu_io_v1.X/dlog.h"
 // *****************************************************************************
 // *****************************************************************************
 // Section: Main Entry Point
 // *****************************************************************************
 // *****************************************************************************
 
+/* One Modbus slave per serial port, each port is its own RS-485 segment */
+typedef struct _port_t {
+    const serial_t  *serial;
+    int             baud;
+    mb_mapping_t    *mapping;
+} port_t;
+
+/* Register map shared by the ports serving the I/O, a port may also be given
+   a map of its own */
+static mb_mapping_t mapping;
+static mb_mapping_t mapping_uart4;
+
+static const port_t ports[] = {
+    { &uart1, 9600,  &mapping },
+    { &uart3, 19200, &mapping },
+    { &uart4, 19200, &mapping_uart4 },
+};
+
+#define NB_PORTS    (sizeof(ports) / sizeof(ports[0]))
+
+static mb_t mb[NB_PORTS];
+
 int main ( void )
 {
     int rc = 0;
+    size_t i;
     
     /* Initialize all modules */
     SYS_Initialize ( NULL );
     
-    ioctl_init();
-    mb_init(9600);
+    dlog_init(UART2_TransmitterIsReady, UART2_WriteByte);
+    mb_mapping_init(&mapping);
+    mb_mapping_init(&mapping_uart4);
+    for (i = 0; i < NB_PORTS; i++) {
+        mb_init(&mb[i], ports[i].mapping, ports[i].serial, ports[i].baud);
+    }
+    ioctl_init(&mb[0]);
+    for (i = 1; i < NB_PORTS; i++) {
+        ioctl_attach(&mb[i]);
+    }
     
     while ( true )
     {
         /* Maintain state machines of all polled MPLAB Harmony modules. */
         SYS_Tasks ( );
         
-        rc = mb_loop();
-        if (rc == 0) {
-            // listenning
-        }
-        else if (rc > 0) {
-            printf("MODBUS RTU exchange successful\n");
-        }
-        else {
-            printf("MODBUS RTU exchange error, code = %d\n", rc);
+        /* Every port receives from its own interrupt, a pass never waits
+           on any of them */
+        for (i = 0; i < NB_PORTS; i++) {
+            rc = mb_loop(&mb[i]);
+            if (rc == 0) {
+                // listenning
+            }
+            else if (rc > 0) {
+                dlog(DLOG_MB_EXCHANGE_OK, rc, i);
+            }
+            else {
+                dlog(DLOG_MB_EXCHANGE_ERROR, rc, i);
+            }
         }
         ioctl_loop();
+        dlog_task();
     }
 
     /* Execution should not come here during normal operation */